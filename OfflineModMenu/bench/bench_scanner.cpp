@@ -0,0 +1,244 @@
+//! Microbenchmarks for the scan engine's hot paths.
+//!
+//! Usage: bench_scanner [--mb <size>] [--dirty <percent>]
+//!
+//! Spawns a copy of itself as the scan target (bench_scanner --sleep),
+//! seeds the target's memory with VirtualAllocEx/WriteProcessMemory, and
+//! benchmarks against it so ReadProcessMemory costs are the real
+//! cross-process kind, not a memcpy in disguise. Kernel-only benchmarks
+//! (deltaCompareI32, patternSearch) run on local synthetic buffers.
+
+#include "candidate_set.hpp"
+#include "memory.hpp"
+#include "scan_kernels.hpp"
+#include "worker_pool.hpp"
+
+#include <windows.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+double toGiBps(size_t bytes, double seconds) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0 * 1024.0) / seconds;
+}
+
+//! Fills a buffer with deterministic pseudo-random 32-bit values.
+void fillRandom(uint8_t* data, size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i + sizeof(uint32_t) <= size; i += sizeof(uint32_t)) {
+        const uint32_t value = rng();
+        std::memcpy(data + i, &value, sizeof(value));
+    }
+}
+
+//! Bumps `dirtyPercent` of the 32-bit slots by +1 to simulate gameplay churn.
+void dirtyBuffer(uint8_t* data, size_t size, double dirtyPercent, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> roll(0.0, 100.0);
+    for (size_t i = 0; i + sizeof(int) <= size; i += sizeof(int)) {
+        if (roll(rng) < dirtyPercent) {
+            int value = 0;
+            std::memcpy(&value, data + i, sizeof(value));
+            ++value;
+            std::memcpy(data + i, &value, sizeof(value));
+        }
+    }
+}
+
+//! The spawned self-target: a live process whose memory the parent reads.
+int runSleepTarget() {
+    for (;;) {
+        Sleep(60 * 1000);
+    }
+}
+
+struct TargetProcess {
+    PROCESS_INFORMATION info{};
+    uintptr_t remoteBase = 0;
+
+    ~TargetProcess() {
+        if (info.hProcess) {
+            TerminateProcess(info.hProcess, 0);
+            CloseHandle(info.hThread);
+            CloseHandle(info.hProcess);
+        }
+    }
+};
+
+//! Spawns bench_scanner --sleep and seeds `size` bytes into it.
+bool spawnTarget(TargetProcess& target, const uint8_t* seedData, size_t size) {
+    wchar_t selfPath[MAX_PATH] = {};
+    GetModuleFileNameW(nullptr, selfPath, MAX_PATH);
+
+    std::wstring commandLine = L"\"" + std::wstring(selfPath) + L"\" --sleep";
+    STARTUPINFOW startup{};
+    startup.cb = sizeof(startup);
+    if (!CreateProcessW(selfPath, commandLine.data(), nullptr, nullptr, FALSE,
+                        CREATE_NO_WINDOW, nullptr, nullptr, &startup, &target.info)) {
+        std::fprintf(stderr, "failed to spawn self-target (%lu)\n", GetLastError());
+        return false;
+    }
+
+    void* remote = VirtualAllocEx(target.info.hProcess, nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!remote) {
+        std::fprintf(stderr, "VirtualAllocEx failed (%lu)\n", GetLastError());
+        return false;
+    }
+
+    SIZE_T written = 0;
+    if (!WriteProcessMemory(target.info.hProcess, remote, seedData, size, &written) || written != size) {
+        std::fprintf(stderr, "failed to seed target memory\n");
+        return false;
+    }
+
+    target.remoteBase = reinterpret_cast<uintptr_t>(remote);
+    return true;
+}
+
+void benchDeltaCompare(const std::vector<uint8_t>& previous, const std::vector<uint8_t>& current) {
+    const size_t valueCount = previous.size() / sizeof(int);
+    std::vector<uintptr_t> matches;
+    matches.reserve(valueCount / 16);
+
+    const auto start = Clock::now();
+    scan::deltaCompareI32(previous.data(), current.data(), valueCount, 1, 0x10000, matches);
+    const double seconds = secondsSince(start);
+
+    std::printf("deltaCompareI32 (%s): %7.2f GiB/s, %10.0f candidates/s (%zu matches)\n",
+                scan::usingAvx2() ? "AVX2" : "scalar",
+                toGiBps(previous.size() * 2, seconds),
+                static_cast<double>(matches.size()) / seconds, matches.size());
+}
+
+void benchCompareSnapshots(MemoryScanner& scanner, const std::vector<uint8_t>& previous,
+                           const std::vector<uint8_t>& current) {
+    MemorySnapshot before;
+    before.base = 0x10000;
+    before.data = previous;
+    MemorySnapshot after;
+    after.base = 0x10000;
+    after.data = current;
+
+    const auto start = Clock::now();
+    CandidateSet candidates = scanner.compareSnapshots(before, after, 1);
+    const double seconds = secondsSince(start);
+
+    std::printf("compareSnapshots (pooled):   %7.2f GiB/s, %10.0f candidates/s (%zu matches)\n",
+                toGiBps(previous.size() * 2, seconds),
+                static_cast<double>(candidates.count()) / seconds, candidates.count());
+}
+
+void benchPatternSearch(const std::vector<uint8_t>& haystack) {
+    const auto signature = parseSignature("DE AD ?? ?? BE EF");
+    std::vector<uintptr_t> matches;
+
+    const auto start = Clock::now();
+    scan::patternSearch(haystack.data(), haystack.size(), signature->bytes.data(), signature->mask.data(),
+                        signature->bytes.size(), signature->anchor, 0x10000, matches);
+    const double seconds = secondsSince(start);
+
+    std::printf("patternSearch (%s):    %7.2f GiB/s (%zu matches)\n",
+                scan::usingAvx2() ? "AVX2" : "scalar", toGiBps(haystack.size(), seconds), matches.size());
+}
+
+void benchFilterCandidates(MemoryScanner& scanner, uintptr_t remoteBase, size_t size) {
+    // Every slot starts as a candidate; the pass narrows against live target
+    // memory with coalesced ranged reads.
+    CandidateSet candidates;
+    candidates.addRegion(remoteBase, size);
+    candidates.fillAll();
+
+    const auto start = Clock::now();
+    scanner.filterCandidates<int32_t>(candidates, 0);
+    const double seconds = secondsSince(start);
+
+    std::printf("filterCandidates (remote):   %7.2f GiB/s, %10.0f candidates/s kept %zu\n",
+                toGiBps(size, seconds),
+                static_cast<double>(size / sizeof(int32_t)) / seconds, candidates.count());
+}
+
+void benchFreezeCycle(HANDLE process, uintptr_t remoteBase) {
+    // The freeze loop's primitive: read an entry, compare, write it back.
+    // Reported as cycles/s ~= the syscall pair rate one frozen value costs.
+    constexpr size_t kEntries = 64;
+    constexpr size_t kIterations = 2000;
+    int value = 12345;
+
+    const auto start = Clock::now();
+    size_t cycles = 0;
+    for (size_t iteration = 0; iteration < kIterations; ++iteration) {
+        for (size_t entry = 0; entry < kEntries; ++entry) {
+            const uintptr_t address = remoteBase + entry * sizeof(int);
+            int live = 0;
+            SIZE_T transferred = 0;
+            ReadProcessMemory(process, reinterpret_cast<LPCVOID>(address), &live, sizeof(live), &transferred);
+            if (live != value) {
+                WriteProcessMemory(process, reinterpret_cast<LPVOID>(address), &value, sizeof(value), &transferred);
+            }
+            ++cycles;
+        }
+    }
+    const double seconds = secondsSince(start);
+
+    std::printf("freeze cycle (read+cmp+write): %9.0f cycles/s over %zu entries\n",
+                static_cast<double>(cycles) / seconds, kEntries);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t sizeMiB = 256;
+    double dirtyPercent = 2.0;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--sleep") {
+            return runSleepTarget();
+        }
+        if (arg == "--mb" && i + 1 < argc) {
+            sizeMiB = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--dirty" && i + 1 < argc) {
+            dirtyPercent = std::strtod(argv[++i], nullptr);
+        } else {
+            std::fprintf(stderr, "usage: bench_scanner [--mb <size>] [--dirty <percent>]\n");
+            return 1;
+        }
+    }
+
+    const size_t size = sizeMiB * 1024 * 1024;
+    std::printf("bench_scanner: %zu MiB snapshots, %.1f%% dirty, %s kernels\n\n",
+                sizeMiB, dirtyPercent, scan::usingAvx2() ? "AVX2" : "scalar");
+
+    std::vector<uint8_t> previous(size);
+    fillRandom(previous.data(), size, 42);
+    std::vector<uint8_t> current = previous;
+    dirtyBuffer(current.data(), size, dirtyPercent, 1337);
+
+    benchDeltaCompare(previous, current);
+
+    MemoryScanner scanner;
+    benchCompareSnapshots(scanner, previous, current);
+    benchPatternSearch(current);
+
+    TargetProcess target;
+    if (spawnTarget(target, previous.data(), size)) {
+        scanner.setProcess(target.info.hProcess);
+        benchFilterCandidates(scanner, target.remoteBase, size);
+        benchFreezeCycle(target.info.hProcess, target.remoteBase);
+    }
+
+    return 0;
+}
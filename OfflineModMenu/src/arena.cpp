@@ -0,0 +1,37 @@
+#include "arena.hpp"
+
+#include <algorithm>
+
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (Block& block : m_blocks) {
+        const size_t aligned = (block.used + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= block.capacity) {
+            block.used = aligned + bytes;
+            return block.data.get() + aligned;
+        }
+    }
+
+    Block block;
+    block.capacity = std::max(kBlockBytes, bytes + alignment);
+    block.data = std::make_unique<uint8_t[]>(block.capacity);
+    const size_t base = reinterpret_cast<uintptr_t>(block.data.get()) & (alignment - 1);
+    const size_t aligned = base == 0 ? 0 : alignment - base;
+    block.used = aligned + bytes;
+    void* result = block.data.get() + aligned;
+    m_blocks.push_back(std::move(block));
+    return result;
+}
+
+void Arena::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Block& block : m_blocks) {
+        block.used = 0;
+    }
+}
+
+void Arena::release() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_blocks.clear();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//! Chunked bump allocator backing per-pass scan scratch buffers.
+//!
+//! allocate() hands out aligned slices of megabyte blocks; individual
+//! deallocation is a no-op, so the memory is reclaimed wholesale — reset()
+//! recycles every block without touching the heap, release() returns them.
+//! Allocation takes a short lock so parallel scan stages can share one arena.
+class Arena {
+public:
+    //! Returns `bytes` of storage aligned to `alignment`, carving from the
+    //! current block or opening a new one when it runs out.
+    void* allocate(size_t bytes, size_t alignment);
+
+    //! Marks every block empty again while keeping its memory for the next pass.
+    void reset();
+
+    //! Frees all blocks; the next allocation starts from scratch.
+    void release();
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    static constexpr size_t kBlockBytes = 1u << 20;
+
+    std::mutex m_mutex;
+    std::vector<Block> m_blocks;
+};
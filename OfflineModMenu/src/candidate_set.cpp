@@ -0,0 +1,164 @@
+#include "candidate_set.hpp"
+
+#include <algorithm>
+
+namespace {
+
+inline size_t wordCountFor(size_t slotCount) {
+    return (slotCount + 63) / 64;
+}
+
+inline size_t popcount64(uint64_t word) {
+    size_t count = 0;
+    while (word != 0) {
+        word &= word - 1;
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+void CandidateSet::addRegion(uintptr_t base, size_t size) {
+    RegionBits region;
+    region.base = base;
+    region.slotCount = size / m_slotBytes;
+    region.words.assign(wordCountFor(region.slotCount), 0);
+    m_regions.push_back(std::move(region));
+}
+
+const CandidateSet::RegionBits* CandidateSet::findRegion(uintptr_t address) const {
+    auto it = std::upper_bound(m_regions.begin(), m_regions.end(), address, [](uintptr_t addr, const RegionBits& region) {
+        return addr < region.base;
+    });
+    if (it == m_regions.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (address >= it->base + it->slotCount * m_slotBytes) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+CandidateSet::RegionBits* CandidateSet::findRegion(uintptr_t address) {
+    return const_cast<RegionBits*>(static_cast<const CandidateSet*>(this)->findRegion(address));
+}
+
+void CandidateSet::add(uintptr_t address) {
+    RegionBits* region = findRegion(address);
+    if (!region) {
+        return;
+    }
+    const size_t slot = (address - region->base) / m_slotBytes;
+    region->words[slot / 64] |= uint64_t(1) << (slot % 64);
+}
+
+bool CandidateSet::contains(uintptr_t address) const {
+    const RegionBits* region = findRegion(address);
+    if (!region) {
+        return false;
+    }
+    const size_t slot = (address - region->base) / m_slotBytes;
+    return (region->words[slot / 64] & (uint64_t(1) << (slot % 64))) != 0;
+}
+
+void CandidateSet::remove(uintptr_t address) {
+    RegionBits* region = findRegion(address);
+    if (!region) {
+        return;
+    }
+    const size_t slot = (address - region->base) / m_slotBytes;
+    region->words[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+}
+
+void CandidateSet::fillAll() {
+    for (auto& region : m_regions) {
+        std::fill(region.words.begin(), region.words.end(), ~uint64_t(0));
+        // Mask off bits past the final slot so counts and iteration stay exact.
+        const size_t tail = region.slotCount % 64;
+        if (tail != 0 && !region.words.empty()) {
+            region.words.back() = (uint64_t(1) << tail) - 1;
+        }
+    }
+}
+
+uint64_t* CandidateSet::regionWords(uintptr_t base, size_t* slotCount) {
+    RegionBits* region = findRegion(base);
+    if (!region || region->base != base) {
+        return nullptr;
+    }
+    if (slotCount) {
+        *slotCount = region->slotCount;
+    }
+    return region->words.data();
+}
+
+void CandidateSet::intersect(const CandidateSet& other) {
+    for (auto& region : m_regions) {
+        const RegionBits* match = other.findRegion(region.base);
+        if (!match || match->base != region.base) {
+            std::fill(region.words.begin(), region.words.end(), 0);
+            continue;
+        }
+        const size_t shared = std::min(region.words.size(), match->words.size());
+        for (size_t i = 0; i < shared; ++i) {
+            region.words[i] &= match->words[i];
+        }
+        std::fill(region.words.begin() + shared, region.words.end(), 0);
+    }
+}
+
+size_t CandidateSet::count() const {
+    size_t total = 0;
+    for (const auto& region : m_regions) {
+        for (uint64_t word : region.words) {
+            total += popcount64(word);
+        }
+    }
+    return total;
+}
+
+void CandidateSet::clear() {
+    m_regions.clear();
+}
+
+void CandidateSet::forEach(const std::function<void(uintptr_t)>& fn) const {
+    for (const auto& region : m_regions) {
+        for (size_t wordIndex = 0; wordIndex < region.words.size(); ++wordIndex) {
+            // Copy the word so callers may remove the current address mid-iteration.
+            uint64_t word = region.words[wordIndex];
+            while (word != 0) {
+                uint64_t lowest = word & (~word + 1);
+                size_t bit = 0;
+                for (uint64_t probe = lowest >> 1; probe != 0; probe >>= 1) {
+                    ++bit;
+                }
+                fn(region.base + (wordIndex * 64 + bit) * m_slotBytes);
+                word &= word - 1;
+            }
+        }
+    }
+}
+
+std::vector<uintptr_t> CandidateSet::toAddresses(size_t limit) const {
+    std::vector<uintptr_t> addresses;
+    for (const auto& region : m_regions) {
+        for (size_t wordIndex = 0; wordIndex < region.words.size() && addresses.size() < limit; ++wordIndex) {
+            uint64_t word = region.words[wordIndex];
+            while (word != 0 && addresses.size() < limit) {
+                uint64_t lowest = word & (~word + 1);
+                size_t bit = 0;
+                for (uint64_t probe = lowest >> 1; probe != 0; probe >>= 1) {
+                    ++bit;
+                }
+                addresses.push_back(region.base + (wordIndex * 64 + bit) * m_slotBytes);
+                word &= word - 1;
+            }
+        }
+        if (addresses.size() >= limit) {
+            break;
+        }
+    }
+    return addresses;
+}
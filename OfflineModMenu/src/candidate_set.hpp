@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//! Compact per-region candidate bitmap used by the scan passes.
+//!
+//! One bit represents one aligned value slot (4 bytes unless reconfigured for
+//! another scan value type), so a region's candidate storage costs a small
+//! fixed fraction of the region itself regardless of how many candidates a
+//! wide first scan produces, and narrowing two scans is a bitwise AND. Regions
+//! must be registered in ascending base order before bits are set.
+class CandidateSet {
+public:
+    //! Width of the slot each bit represents. Must be set before addRegion.
+    void setSlotBytes(size_t slotBytes) { m_slotBytes = slotBytes; }
+    size_t slotBytes() const { return m_slotBytes; }
+
+    //! Registers a region the set can hold candidates for. Call in ascending base order.
+    void addRegion(uintptr_t base, size_t size);
+
+    //! Marks the slot containing the address. Addresses outside known regions are ignored.
+    void add(uintptr_t address);
+
+    //! Returns whether the slot containing the address is marked.
+    bool contains(uintptr_t address) const;
+
+    //! Unmarks the slot containing the address.
+    void remove(uintptr_t address);
+
+    //! Marks every slot in every region — the starting state of an unknown-value scan.
+    void fillAll();
+
+    //! Keeps only candidates present in both sets (regions are matched by base).
+    void intersect(const CandidateSet& other);
+
+    //! Direct word access to a region's bitmap for the scan engine's hot loops.
+    //! Bit i of word w covers the slot at base + (w * 64 + i) * slotBytes().
+    uint64_t* regionWords(uintptr_t base, size_t* slotCount = nullptr);
+
+    //! Number of marked slots across all regions.
+    size_t count() const;
+
+    bool empty() const { return count() == 0; }
+
+    void clear();
+
+    //! Invokes fn(address) for every marked slot in ascending address order.
+    //! Removing already-visited addresses (including the current one) is allowed.
+    void forEach(const std::function<void(uintptr_t)>& fn) const;
+
+    //! Materializes up to limit addresses, lowest first — for UI lists and freezes.
+    std::vector<uintptr_t> toAddresses(size_t limit = SIZE_MAX) const;
+
+private:
+    struct RegionBits {
+        uintptr_t base = 0;
+        size_t slotCount = 0;
+        std::vector<uint64_t> words;
+    };
+
+    const RegionBits* findRegion(uintptr_t address) const;
+    RegionBits* findRegion(uintptr_t address);
+
+    std::vector<RegionBits> m_regions;
+    size_t m_slotBytes = sizeof(int);
+};
@@ -3,12 +3,164 @@
 #include "utils.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 
 using nlohmann::json;
 
+namespace {
+// On-disk layout of the binary config cache: header, then length-prefixed
+// entries per table. The JSON stays the human-editable source of truth; the
+// cache is regenerated whenever it is older than the JSON and is loaded with
+// one sequential read and no parsing beyond pointer walks.
+constexpr uint32_t kConfigCacheMagic = 0x43434D4F; // "OMCC"
+constexpr uint32_t kConfigCacheVersion = 2;
+
+struct ConfigCacheHeader {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t addressCount = 0;
+    uint32_t signatureCount = 0;
+    uint32_t chainCount = 0;
+    uint32_t modCount = 0;
+};
+
+void appendRaw(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const uint8_t* raw = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), raw, raw + size);
+}
+
+void appendString(std::vector<uint8_t>& out, const std::string& value) {
+    const uint16_t length = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    appendRaw(out, &length, sizeof(length));
+    appendRaw(out, value.data(), length);
+}
+
+bool readRaw(const std::vector<uint8_t>& buffer, size_t& cursor, void* dest, size_t size) {
+    if (buffer.size() - cursor < size) {
+        return false;
+    }
+    std::memcpy(dest, buffer.data() + cursor, size);
+    cursor += size;
+    return true;
+}
+
+bool readString(const std::vector<uint8_t>& buffer, size_t& cursor, std::string& dest) {
+    uint16_t length = 0;
+    if (!readRaw(buffer, cursor, &length, sizeof(length)) || buffer.size() - cursor < length) {
+        return false;
+    }
+    dest.assign(reinterpret_cast<const char*>(buffer.data() + cursor), length);
+    cursor += length;
+    return true;
+}
+
+std::vector<uint8_t> encodeConfigCache(const ProcessConfig& config) {
+    std::vector<uint8_t> out;
+    ConfigCacheHeader header;
+    header.magic = kConfigCacheMagic;
+    header.version = kConfigCacheVersion;
+    header.addressCount = static_cast<uint32_t>(config.addresses.size());
+    header.signatureCount = static_cast<uint32_t>(config.signatures.size());
+    header.chainCount = static_cast<uint32_t>(config.chains.size());
+    header.modCount = static_cast<uint32_t>(config.mods.size());
+    appendRaw(out, &header, sizeof(header));
+
+    for (const auto& [name, address] : config.addresses) {
+        appendString(out, name);
+        const uint64_t value = address;
+        appendRaw(out, &value, sizeof(value));
+    }
+    for (const auto& [name, pattern] : config.signatures) {
+        appendString(out, name);
+        appendString(out, pattern);
+    }
+    for (const auto& [name, chain] : config.chains) {
+        appendString(out, name);
+        appendString(out, chain);
+    }
+    for (const auto& [name, state] : config.mods) {
+        appendString(out, name);
+        const uint8_t enabled = state.enabled ? 1 : 0;
+        appendRaw(out, &enabled, sizeof(enabled));
+    }
+    return out;
+}
+
+std::optional<ProcessConfig> decodeConfigCache(const std::vector<uint8_t>& buffer) {
+    size_t cursor = 0;
+    ConfigCacheHeader header;
+    if (!readRaw(buffer, cursor, &header, sizeof(header)) ||
+        header.magic != kConfigCacheMagic || header.version != kConfigCacheVersion) {
+        return std::nullopt;
+    }
+
+    ProcessConfig config;
+    for (uint32_t i = 0; i < header.addressCount; ++i) {
+        std::string name;
+        uint64_t value = 0;
+        if (!readString(buffer, cursor, name) || !readRaw(buffer, cursor, &value, sizeof(value))) {
+            return std::nullopt;
+        }
+        config.addresses[name] = static_cast<uintptr_t>(value);
+    }
+    for (uint32_t i = 0; i < header.signatureCount; ++i) {
+        std::string name;
+        std::string pattern;
+        if (!readString(buffer, cursor, name) || !readString(buffer, cursor, pattern)) {
+            return std::nullopt;
+        }
+        config.signatures[name] = std::move(pattern);
+    }
+    for (uint32_t i = 0; i < header.chainCount; ++i) {
+        std::string name;
+        std::string chain;
+        if (!readString(buffer, cursor, name) || !readString(buffer, cursor, chain)) {
+            return std::nullopt;
+        }
+        config.chains[name] = std::move(chain);
+    }
+    for (uint32_t i = 0; i < header.modCount; ++i) {
+        std::string name;
+        uint8_t enabled = 0;
+        if (!readString(buffer, cursor, name) || !readRaw(buffer, cursor, &enabled, sizeof(enabled))) {
+            return std::nullopt;
+        }
+        config.mods[name] = ModState{ enabled != 0 };
+    }
+    return config;
+}
+
+std::optional<ProcessConfig> loadConfigCache(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    const auto size = file.tellg();
+    file.seekg(0);
+    std::vector<uint8_t> buffer(static_cast<size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+        return std::nullopt;
+    }
+    return decodeConfigCache(buffer);
+}
+}
+
 ConfigManager::ConfigManager() {
     util::ensureDirectories({ std::filesystem::current_path() / "configs" });
+    m_writerRunning = true;
+    m_writer = std::thread(&ConfigManager::writerMain, this);
+}
+
+ConfigManager::~ConfigManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_writerRunning = false;
+    }
+    m_queueCv.notify_all();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
 }
 
 std::optional<ProcessConfig> ConfigManager::load(const std::string& processName) {
@@ -18,6 +170,21 @@ std::optional<ProcessConfig> ConfigManager::load(const std::string& processName)
         return std::nullopt;
     }
 
+    std::lock_guard<std::mutex> ioLock(m_ioMutex);
+
+    // The binary sidecar is authoritative only while it is at least as new as
+    // the JSON; a hand-edited JSON invalidates it by timestamp alone.
+    const auto cachePath = resolveCachePath(processName);
+    std::error_code ec;
+    if (std::filesystem::exists(cachePath, ec) &&
+        std::filesystem::last_write_time(cachePath, ec) >= std::filesystem::last_write_time(path, ec) && !ec) {
+        if (auto cached = loadConfigCache(cachePath)) {
+            util::Logger::instance().log(util::Logger::Level::Info, "Loaded config for " + processName + " from binary cache");
+            return cached;
+        }
+        util::Logger::instance().log(util::Logger::Level::Warning, "Config cache unreadable for " + processName + "; falling back to JSON");
+    }
+
     std::ifstream file(path);
     if (!file.is_open()) {
         util::Logger::instance().log(util::Logger::Level::Error, "Failed to open config for " + processName);
@@ -34,6 +201,18 @@ std::optional<ProcessConfig> ConfigManager::load(const std::string& processName)
         }
     }
 
+    if (j.contains("signatures")) {
+        for (auto& [key, value] : j["signatures"].items()) {
+            config.signatures[key] = value.get<std::string>();
+        }
+    }
+
+    if (j.contains("chains")) {
+        for (auto& [key, value] : j["chains"].items()) {
+            config.chains[key] = value.get<std::string>();
+        }
+    }
+
     if (j.contains("mods")) {
         for (auto& [key, value] : j["mods"].items()) {
             config.mods[key] = ModState{ value.value("enabled", false) };
@@ -41,28 +220,91 @@ std::optional<ProcessConfig> ConfigManager::load(const std::string& processName)
     }
 
     util::Logger::instance().log(util::Logger::Level::Info, "Loaded config for " + processName);
+
+    // Regenerate the cache off-thread so the next attach skips the JSON parse.
+    enqueueSave(PendingSave{ processName, config, /*writeJson=*/false });
     return config;
 }
 
 void ConfigManager::save(const std::string& processName, const ProcessConfig& config) {
-    json j;
-    for (const auto& [name, address] : config.addresses) {
-        j["addresses"][name] = address;
+    // Serialization and the pretty-printed write both happen on the writer
+    // thread; the render thread only pays for this copy.
+    enqueueSave(PendingSave{ processName, config, /*writeJson=*/true });
+}
+
+void ConfigManager::enqueueSave(PendingSave save) {
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        // Latest save per process wins; superseded entries keep their JSON
+        // flag so a queued user save is never downgraded to a cache refresh.
+        auto it = std::find_if(m_pendingSaves.begin(), m_pendingSaves.end(), [&](const PendingSave& pending) {
+            return pending.processName == save.processName;
+        });
+        if (it != m_pendingSaves.end()) {
+            save.writeJson = save.writeJson || it->writeJson;
+            *it = std::move(save);
+        } else {
+            m_pendingSaves.push_back(std::move(save));
+        }
     }
+    m_queueCv.notify_all();
+}
 
-    for (const auto& [name, state] : config.mods) {
-        j["mods"][name]["enabled"] = state.enabled;
+void ConfigManager::writerMain() {
+    while (true) {
+        PendingSave save;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCv.wait(lock, [this]() { return !m_pendingSaves.empty() || !m_writerRunning; });
+            if (m_pendingSaves.empty()) {
+                // Shutting down with nothing queued; pending saves drain first.
+                return;
+            }
+            save = std::move(m_pendingSaves.front());
+            m_pendingSaves.erase(m_pendingSaves.begin());
+        }
+        performSave(save);
     }
+}
 
-    const auto path = resolvePath(processName);
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        util::Logger::instance().log(util::Logger::Level::Error, "Unable to save config for " + processName);
+void ConfigManager::performSave(const PendingSave& save) {
+    std::lock_guard<std::mutex> ioLock(m_ioMutex);
+
+    if (save.writeJson) {
+        json j;
+        for (const auto& [name, address] : save.config.addresses) {
+            j["addresses"][name] = address;
+        }
+        for (const auto& [name, pattern] : save.config.signatures) {
+            j["signatures"][name] = pattern;
+        }
+        for (const auto& [name, chain] : save.config.chains) {
+            j["chains"][name] = chain;
+        }
+        for (const auto& [name, state] : save.config.mods) {
+            j["mods"][name]["enabled"] = state.enabled;
+        }
+
+        std::ofstream file(resolvePath(save.processName));
+        if (!file.is_open()) {
+            util::Logger::instance().log(util::Logger::Level::Error, "Unable to save config for " + save.processName);
+            return;
+        }
+        file << std::setw(4) << j;
+    }
+
+    // The cache is written after the JSON so its timestamp marks it fresh.
+    const std::vector<uint8_t> encoded = encodeConfigCache(save.config);
+    std::ofstream cacheFile(resolveCachePath(save.processName), std::ios::binary | std::ios::trunc);
+    if (!cacheFile.is_open()) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Unable to write config cache for " + save.processName);
         return;
     }
+    cacheFile.write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
 
-    file << std::setw(4) << j;
-    util::Logger::instance().log(util::Logger::Level::Info, "Saved config for " + processName);
+    if (save.writeJson) {
+        util::Logger::instance().log(util::Logger::Level::Info, "Saved config for " + save.processName);
+    }
 }
 
 std::filesystem::path ConfigManager::resolvePath(const std::string& processName) const {
@@ -71,3 +313,6 @@ std::filesystem::path ConfigManager::resolvePath(const std::string& processName)
     return std::filesystem::current_path() / "configs" / (sanitized + ".json");
 }
 
+std::filesystem::path ConfigManager::resolveCachePath(const std::string& processName) const {
+    return resolvePath(processName).replace_extension(".omc");
+}
@@ -4,10 +4,15 @@
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <filesystem>
+#include <vector>
 
 struct ModState {
     bool enabled = false;
@@ -15,20 +20,49 @@ struct ModState {
 
 struct ProcessConfig {
     std::unordered_map<std::string, uintptr_t> addresses;
+    //! Wildcarded byte signatures (e.g. "8B 81 ?? ?? 00 00") keyed by name;
+    //! unlike raw addresses these survive game updates and relocation.
+    std::unordered_map<std::string, std::string> signatures;
+    //! Module-relative pointer chains in formatChain() text form (e.g.
+    //! "game.exe+0x17E0A8 0x10 0x8"), re-resolved at every (re)attach.
+    std::unordered_map<std::string, std::string> chains;
     std::unordered_map<std::string, ModState> mods;
 };
 
 class ConfigManager {
 public:
     ConfigManager();
+    ~ConfigManager();
 
-    //! Loads configuration for the specified process name.
+    //! Loads configuration for the specified process name. Reads the binary
+    //! sidecar cache in one pass when it is fresh; otherwise parses the JSON
+    //! source and queues a cache regeneration on the writer thread.
     std::optional<ProcessConfig> load(const std::string& processName);
 
-    //! Saves configuration for the specified process name.
+    //! Saves configuration for the specified process name. The write happens
+    //! on the background writer thread, so saving never hitches a frame.
     void save(const std::string& processName, const ProcessConfig& config);
 
 private:
+    //! One queued write: the JSON source (when user-initiated) plus the
+    //! binary sidecar. Latest save per process wins; earlier ones are dropped.
+    struct PendingSave {
+        std::string processName;
+        ProcessConfig config;
+        bool writeJson = true;
+    };
+
     std::filesystem::path resolvePath(const std::string& processName) const;
-};
+    std::filesystem::path resolveCachePath(const std::string& processName) const;
+    void enqueueSave(PendingSave save);
+    void writerMain();
+    void performSave(const PendingSave& save);
 
+    std::thread m_writer;
+    std::atomic<bool> m_writerRunning{false};
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCv;
+    std::vector<PendingSave> m_pendingSaves;
+    //! Serializes file access between load() and the writer thread.
+    std::mutex m_ioMutex;
+};
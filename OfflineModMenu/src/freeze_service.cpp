@@ -0,0 +1,207 @@
+#include "freeze_service.hpp"
+
+#include "perf.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+// Cadence bounds for the adaptive refresh: contested values are held at the
+// tick rate, untouched ones back off exponentially toward one second.
+constexpr std::chrono::milliseconds kTickInterval{5};
+constexpr std::chrono::milliseconds kMinRefreshInterval{5};
+constexpr std::chrono::milliseconds kMaxRefreshInterval{1000};
+} // namespace
+
+FreezeService& FreezeService::instance() {
+    static FreezeService service;
+    return service;
+}
+
+FreezeService::~FreezeService() {
+    m_running = false;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void FreezeService::setProcess(HANDLE process) {
+    m_process.store(process);
+}
+
+void FreezeService::freeze(const std::string& owner, uintptr_t address, const void* buffer, size_t size) {
+    Command command;
+    command.op = CommandOp::Freeze;
+    command.address = address;
+    command.value.assign(buffer, size);
+    command.owner = owner;
+    submit(std::move(command));
+}
+
+void FreezeService::unfreeze(uintptr_t address) {
+    Command command;
+    command.op = CommandOp::Unfreeze;
+    command.address = address;
+    submit(std::move(command));
+}
+
+void FreezeService::clearOwner(const std::string& owner) {
+    Command command;
+    command.op = CommandOp::ClearOwner;
+    command.owner = owner;
+    submit(std::move(command));
+}
+
+void FreezeService::clearAll() {
+    Command command;
+    command.op = CommandOp::ClearAll;
+    submit(std::move(command));
+}
+
+void FreezeService::submit(Command command) {
+    // Producers only touch the lock-free queue; the loop thread owns the table.
+    if (!m_commands.tryPush(std::move(command))) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Freeze command queue full; command dropped");
+        return;
+    }
+
+    if (!m_threadStarted.exchange(true)) {
+        m_running = true;
+        m_thread = std::thread(&FreezeService::loop, this);
+    }
+}
+
+void FreezeService::drainCommands() {
+    Command command;
+    while (m_commands.tryPop(command)) {
+        applyCommand(command);
+    }
+}
+
+void FreezeService::applyCommand(Command& command) {
+    switch (command.op) {
+    case CommandOp::Freeze: {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), command.address, [](const Entry& entry, uintptr_t addr) {
+            return entry.address < addr;
+        });
+        if (it != m_entries.end() && it->address == command.address) {
+            it->value = std::move(command.value);
+            it->owner = std::move(command.owner);
+        } else {
+            Entry entry;
+            entry.address = command.address;
+            entry.value = std::move(command.value);
+            entry.owner = std::move(command.owner);
+            // Fresh entries refresh immediately at the fastest cadence; the loop
+            // backs them off once they are observed to stay clean.
+            entry.interval = kMinRefreshInterval;
+            entry.nextDue = std::chrono::steady_clock::now();
+            m_entries.insert(it, std::move(entry));
+        }
+        break;
+    }
+    case CommandOp::Unfreeze:
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [&command](const Entry& entry) {
+            return entry.address == command.address;
+        }), m_entries.end());
+        break;
+    case CommandOp::ClearOwner:
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [&command](const Entry& entry) {
+            return entry.owner == command.owner;
+        }), m_entries.end());
+        break;
+    case CommandOp::ClearAll:
+        m_entries.clear();
+        break;
+    }
+}
+
+void FreezeService::loop() {
+    util::Logger::instance().log(util::Logger::Level::Info, "Freeze service started");
+
+    std::vector<uint8_t> batchBuffer;
+    std::vector<uint8_t> liveBuffer;
+    std::vector<size_t> dueEntries;
+    while (m_running.load()) {
+        drainCommands();
+
+        HANDLE process = m_process.load();
+        if (process && !m_entries.empty()) {
+            ScopedPerfTimer cycleTimer(PerfMonitor::Section::FreezeCycle);
+            const auto now = std::chrono::steady_clock::now();
+
+            dueEntries.clear();
+            for (size_t i = 0; i < m_entries.size(); ++i) {
+                if (m_entries[i].nextDue <= now) {
+                    dueEntries.push_back(i);
+                }
+            }
+
+            // Entries are sorted, so contiguous due values collapse into one write.
+            size_t batchBegin = 0;
+            while (batchBegin < dueEntries.size()) {
+                size_t batchEnd = batchBegin + 1;
+                while (batchEnd < dueEntries.size() &&
+                       dueEntries[batchEnd] == dueEntries[batchEnd - 1] + 1 &&
+                       m_entries[dueEntries[batchEnd - 1]].address + m_entries[dueEntries[batchEnd - 1]].value.size()
+                           == m_entries[dueEntries[batchEnd]].address) {
+                    ++batchEnd;
+                }
+
+                const uintptr_t batchAddress = m_entries[dueEntries[batchBegin]].address;
+                batchBuffer.clear();
+                for (size_t i = batchBegin; i < batchEnd; ++i) {
+                    const Entry& entry = m_entries[dueEntries[i]];
+                    batchBuffer.insert(batchBuffer.end(), entry.value.data(), entry.value.data() + entry.value.size());
+                }
+
+                // Read the live bytes first (one syscall for the whole batch); the
+                // per-entry comparison both gates the write and drives the cadence.
+                bool haveLiveBytes = false;
+                liveBuffer.resize(batchBuffer.size());
+                SIZE_T bytesRead = 0;
+                PerfMonitor::instance().add(PerfMonitor::Counter::FreezeReads, 1);
+                if (ReadProcessMemory(process, reinterpret_cast<LPCVOID>(batchAddress),
+                                      liveBuffer.data(), liveBuffer.size(), &bytesRead) &&
+                    bytesRead == liveBuffer.size()) {
+                    haveLiveBytes = true;
+                }
+
+                bool needsWrite = !haveLiveBytes;
+                size_t sliceOffset = 0;
+                for (size_t i = batchBegin; i < batchEnd; ++i) {
+                    Entry& entry = m_entries[dueEntries[i]];
+                    const bool dirty = !haveLiveBytes ||
+                        std::memcmp(liveBuffer.data() + sliceOffset, entry.value.data(), entry.value.size()) != 0;
+                    sliceOffset += entry.value.size();
+
+                    if (dirty) {
+                        needsWrite = true;
+                        entry.interval = kMinRefreshInterval;
+                    } else {
+                        entry.interval = std::min(entry.interval * 2, kMaxRefreshInterval);
+                    }
+                    entry.nextDue = now + entry.interval;
+                }
+
+                if (needsWrite) {
+                    SIZE_T bytesWritten = 0;
+                    PerfMonitor::instance().add(PerfMonitor::Counter::FreezeWrites, 1);
+                    if (!WriteProcessMemory(process, reinterpret_cast<LPVOID>(batchAddress),
+                                            batchBuffer.data(), batchBuffer.size(), &bytesWritten) ||
+                        bytesWritten != batchBuffer.size()) {
+                        util::Logger::instance().log(util::Logger::Level::Warning, "Failed to maintain frozen value");
+                    }
+                }
+
+                batchBegin = batchEnd;
+            }
+        }
+
+        std::this_thread::sleep_for(kTickInterval);
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info, "Freeze service stopped");
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "mpsc_queue.hpp"
+
+#include <windows.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! Process-wide freeze service shared by all mods and the manual scan flow.
+//!
+//! Entries are kept sorted by address and adjacent entries are coalesced into
+//! single ranged WriteProcessMemory calls, so N frozen values cost far fewer
+//! syscalls than N independent writes — and the whole application runs one
+//! freeze thread instead of one per mod. Owners tag their entries so a mod can
+//! drop its freezes on detach without touching anyone else's.
+//!
+//! Registration goes through a lock-free MPSC queue drained at the top of each
+//! freeze cycle; the entry table itself is owned exclusively by the loop
+//! thread, so toggling a mod from the UI never waits on an in-flight write pass.
+class FreezeService {
+public:
+    //! Returns the global service instance.
+    static FreezeService& instance();
+
+    ~FreezeService();
+
+    //! Sets the target process handle used by the freeze loop.
+    void setProcess(HANDLE process);
+
+    //! Registers a frozen value under the owner tag, or updates it in place.
+    void freeze(const std::string& owner, uintptr_t address, const void* buffer, size_t size);
+
+    //! Removes the entry at the given address, whoever owns it.
+    void unfreeze(uintptr_t address);
+
+    //! Removes every entry registered under the owner tag.
+    void clearOwner(const std::string& owner);
+
+    //! Removes all entries.
+    void clearAll();
+
+private:
+    enum class CommandOp {
+        Freeze,
+        Unfreeze,
+        ClearOwner,
+        ClearAll
+    };
+
+    //! Frozen bytes with small-buffer storage. Nearly every freeze is a
+    //! scalar of at most 8 bytes, so the common case lives inline and the
+    //! freeze/submit path allocates nothing; rare oversized values (byte
+    //! patches) fall back to one heap block.
+    class SmallValue {
+    public:
+        SmallValue() = default;
+
+        void assign(const void* bytes, size_t size) {
+            m_heap.reset();
+            if (size > sizeof(m_inline)) {
+                m_heap = std::make_unique<uint8_t[]>(size);
+                std::memcpy(m_heap.get(), bytes, size);
+            } else {
+                std::memcpy(m_inline, bytes, size);
+            }
+            m_size = size;
+        }
+
+        const uint8_t* data() const { return m_heap ? m_heap.get() : m_inline; }
+        size_t size() const { return m_size; }
+
+    private:
+        uint8_t m_inline[16] = {};
+        std::unique_ptr<uint8_t[]> m_heap;
+        size_t m_size = 0;
+    };
+
+    struct Command {
+        CommandOp op = CommandOp::ClearAll;
+        uintptr_t address = 0;
+        SmallValue value;
+        std::string owner;
+    };
+
+    //! Loop-thread-owned freeze entry; never touched by producers.
+    //! Each entry carries its own refresh cadence: values the game keeps
+    //! rewriting are held at the minimum interval, values that stay clean back
+    //! off exponentially toward the maximum.
+    struct Entry {
+        uintptr_t address = 0;
+        SmallValue value;
+        std::string owner;
+        std::chrono::milliseconds interval{0};
+        std::chrono::steady_clock::time_point nextDue{};
+    };
+
+    FreezeService() = default;
+
+    void submit(Command command);
+    void drainCommands();
+    void applyCommand(Command& command);
+    void loop();
+
+    std::atomic<HANDLE> m_process{nullptr};
+    MpscQueue<Command, 1024> m_commands;
+    std::vector<Entry> m_entries; // sorted by address, loop-thread-owned
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+    std::atomic<bool> m_threadStarted{false};
+};
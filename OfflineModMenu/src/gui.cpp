@@ -1,5 +1,8 @@
 #include "gui.hpp"
 
+#include "freeze_service.hpp"
+#include "perf.hpp"
+#include "pointer_map.hpp"
 #include "utils.hpp"
 
 #include <imgui.h>
@@ -8,13 +11,102 @@
 #include <backends/imgui_impl_dx11.h>
 
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+std::filesystem::path scanSessionPath() {
+    return std::filesystem::current_path() / "configs" / "scan_session.bin";
+}
+
+//! Encodes a freeze value with the session's value type, so the frozen bytes
+//! have exactly the width and representation the scan matched on. Returns the
+//! payload size.
+size_t encodeScanValue(ScanValueType type, double value, uint8_t* out) {
+    switch (type) {
+    case ScanValueType::Int8: {
+        const int8_t v = static_cast<int8_t>(value);
+        std::memcpy(out, &v, sizeof(v));
+        return sizeof(v);
+    }
+    case ScanValueType::Int16: {
+        const int16_t v = static_cast<int16_t>(value);
+        std::memcpy(out, &v, sizeof(v));
+        return sizeof(v);
+    }
+    case ScanValueType::Int32: {
+        const int32_t v = static_cast<int32_t>(value);
+        std::memcpy(out, &v, sizeof(v));
+        return sizeof(v);
+    }
+    case ScanValueType::Int64: {
+        const int64_t v = static_cast<int64_t>(value);
+        std::memcpy(out, &v, sizeof(v));
+        return sizeof(v);
+    }
+    case ScanValueType::Float: {
+        const float v = static_cast<float>(value);
+        std::memcpy(out, &v, sizeof(v));
+        return sizeof(v);
+    }
+    case ScanValueType::Double:
+        std::memcpy(out, &value, sizeof(value));
+        return sizeof(value);
+    }
+    return 0;
+}
+} // namespace
 
 GUIManager::GUIManager() {
+    m_logLines.resize(kLogCapacity);
     util::Logger::instance().setRealtimeCallback([this](const std::string& line) {
-        m_logBuffer.push_back(line);
+        appendLogLine(line);
     });
 }
 
+GUIManager::~GUIManager() {
+    // The logger singleton (and its flusher thread) outlives this object, and
+    // the callback registered above captures `this`; unhook it before the log
+    // ring it appends to is destroyed.
+    util::Logger::instance().setRealtimeCallback(nullptr);
+}
+
+void GUIManager::appendLogLine(const std::string& line) {
+    m_contentVersion.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_logMutex);
+    m_logLines[m_logCount % kLogCapacity] = line;
+    ++m_logCount;
+
+    // Keep the filtered index current instead of rescanning every frame.
+    if (!m_logFilterActive.empty() && util::toLower(line).find(m_logFilterActive) != std::string::npos) {
+        m_logFiltered.push_back(m_logCount - 1);
+    }
+    const uint64_t oldest = m_logCount > kLogCapacity ? m_logCount - kLogCapacity : 0;
+    while (!m_logFiltered.empty() && m_logFiltered.front() < oldest) {
+        m_logFiltered.erase(m_logFiltered.begin());
+    }
+}
+
+void GUIManager::rebuildLogFilter() {
+    std::lock_guard<std::mutex> lock(m_logMutex);
+    m_logFilterActive = util::toLower(m_logFilter);
+    m_logFiltered.clear();
+    if (m_logFilterActive.empty()) {
+        return;
+    }
+    const uint64_t oldest = m_logCount > kLogCapacity ? m_logCount - kLogCapacity : 0;
+    for (uint64_t seq = oldest; seq < m_logCount; ++seq) {
+        if (util::toLower(m_logLines[seq % kLogCapacity]).find(m_logFilterActive) != std::string::npos) {
+            m_logFiltered.push_back(seq);
+        }
+    }
+}
+
 void GUIManager::initialize(HWND hwnd, ID3D11Device* device, ID3D11DeviceContext* context) {
     if (m_initialized) {
         return;
@@ -55,6 +147,8 @@ void GUIManager::render(ProcessManager& processManager,
         return;
     }
 
+    ScopedPerfTimer frameTimer(PerfMonitor::Section::Frame);
+
     ImGui_ImplDX11_NewFrame();
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
@@ -66,7 +160,7 @@ void GUIManager::render(ProcessManager& processManager,
 
     if (ImGui::BeginTabBar("MainTabs")) {
         if (ImGui::BeginTabItem("Home")) {
-            drawHomeTab();
+            drawHomeTab(processManager, memoryScanner, configManager);
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Mods")) {
@@ -81,6 +175,10 @@ void GUIManager::render(ProcessManager& processManager,
             drawLogTab();
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("Perf")) {
+            drawPerfTab(modManager);
+            ImGui::EndTabItem();
+        }
         if (ImGui::BeginTabItem("Settings")) {
             drawSettingsTab(configManager, processManager, modManager);
             ImGui::EndTabItem();
@@ -88,17 +186,15 @@ void GUIManager::render(ProcessManager& processManager,
         ImGui::EndTabBar();
     }
 
-    drawStatusBar();
+    drawStatusBar(memoryScanner);
 
     ImGui::End();
 
     ImGui::Render();
     ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
-
-    modManager.tick();
 }
 
-void GUIManager::drawHomeTab() {
+void GUIManager::drawHomeTab(ProcessManager& processManager, MemoryScanner& memoryScanner, ConfigManager& configManager) {
     ImGui::TextWrapped("Welcome to the Offline Mod Menu — VonDutch Edition. This toolkit keeps your singleplayer experiences fresh while staying fully offline. Use the Process tab to attach to your game, then explore the Mods tab to enable features like God Mode or Infinity Ammo.");
     ImGui::Spacing();
     ImGui::Separator();
@@ -107,6 +203,221 @@ void GUIManager::drawHomeTab() {
     ImGui::BulletText("Take controlled damage to capture health values.");
     ImGui::BulletText("Use the Next Scan button after each action to narrow results.");
     ImGui::BulletText("Freeze values only after confirming 'YES I OWN THIS COPY'.");
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Text("String / Byte Scanner");
+
+    // Needle searches run over live writable memory on the scan worker thread
+    // and need no session; the chunked search keeps even 10 GB targets quick.
+    static const char* kNeedleKinds[] = { "UTF-8 text", "UTF-16 text", "Byte pattern" };
+    ImGui::SetNextItemWidth(120);
+    ImGui::Combo("##needleKind", &m_needleKindIndex, kNeedleKinds, IM_ARRAYSIZE(kNeedleKinds));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(280);
+    ImGui::InputText("##needleText", m_needleText, sizeof(m_needleText));
+    ImGui::SameLine();
+    if (ImGui::Button("Search") && !memoryScanner.isScanning()) {
+        ByteSignature signature;
+        if (m_needleKindIndex == 2) {
+            // Byte patterns reuse the config signature syntax, wildcards included.
+            if (auto parsed = parseSignature(m_needleText)) {
+                signature = std::move(*parsed);
+            }
+        } else {
+            signature = makeStringSignature(m_needleText,
+                m_needleKindIndex == 1 ? StringEncoding::Utf16 : StringEncoding::Utf8);
+        }
+        if (signature.empty()) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Search needle is empty or malformed");
+        } else if (memoryScanner.startByteSearchAsync(signature)) {
+            m_searchSignature = std::move(signature);
+        }
+    }
+
+    const std::vector<uintptr_t> searchMatches = memoryScanner.searchResults();
+    if (!searchMatches.empty()) {
+        ImGui::Text("Matches: %zu", memoryScanner.searchResultCount());
+        ImGui::BeginChild("SearchResults", ImVec2(0, 120), true);
+        for (uintptr_t address : searchMatches) {
+            char label[32];
+            std::snprintf(label, sizeof(label), "0x%llX", static_cast<unsigned long long>(address));
+            if (ImGui::Selectable(label)) {
+                if (!m_confirmOwnership) {
+                    util::Logger::instance().log(util::Logger::Level::Warning, "Ownership confirmation required before freezing values");
+                } else if (std::find(m_searchSignature.mask.begin(), m_searchSignature.mask.end(), 0) != m_searchSignature.mask.end()) {
+                    // Wildcard slots have no byte image to write back.
+                    util::Logger::instance().log(util::Logger::Level::Warning, "Cannot freeze a match of a wildcarded pattern");
+                } else {
+                    // Freezing a match re-writes the needle bytes, pinning the
+                    // matched string or pattern in place.
+                    FreezeService::instance().freeze("manual", address, m_searchSignature.bytes.data(), m_searchSignature.bytes.size());
+                    util::Logger::instance().log(util::Logger::Level::Info, "Froze " + std::string(label));
+                }
+            }
+        }
+        ImGui::EndChild();
+    }
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Text("Value Scanner");
+
+    // Scan jobs run on the scanner's worker thread; this tab only polls state,
+    // so the frame loop never blocks on a pass.
+    if (memoryScanner.isScanning()) {
+        ImGui::ProgressBar(memoryScanner.scanProgress(), ImVec2(240, 0));
+        ImGui::SameLine();
+        if (ImGui::Button("Cancel")) {
+            memoryScanner.cancelScan();
+        }
+        return;
+    }
+
+    if (!memoryScanner.hasScanSession()) {
+        // Order matches the ScanValueType enum; the type is fixed per session.
+        static const char* kValueTypeNames[] = { "1-byte int", "2-byte int", "4-byte int", "8-byte int", "Float", "Double" };
+        ImGui::SetNextItemWidth(140);
+        ImGui::Combo("Value type", &m_scanValueTypeIndex, kValueTypeNames, IM_ARRAYSIZE(kValueTypeNames));
+        ImGui::SameLine();
+        if (ImGui::Button("First Scan (Unknown Value)")) {
+            memoryScanner.startUnknownScanAsync(static_cast<ScanValueType>(m_scanValueTypeIndex));
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Resume Session")) {
+            memoryScanner.loadScanSession(scanSessionPath());
+        }
+        return;
+    }
+
+    if (ImGui::Button("Increased")) {
+        memoryScanner.startRefineAsync(ScanRefineMode::Increased);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Decreased")) {
+        memoryScanner.startRefineAsync(ScanRefineMode::Decreased);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Changed")) {
+        memoryScanner.startRefineAsync(ScanRefineMode::Changed);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Unchanged")) {
+        memoryScanner.startRefineAsync(ScanRefineMode::Unchanged);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Save Session")) {
+        memoryScanner.saveScanSession(scanSessionPath());
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("End Scan")) {
+        memoryScanner.endScan();
+        return;
+    }
+
+    // Fuzzy narrowing: every predicate reduces to an interval handed to the
+    // vectorized range filter, so engines storing health as 99.99998 are
+    // findable. "Truncated" keeps values whose integer part equals the input.
+    static const char* kFuzzyModes[] = { "Between", "Approximately", "Truncated" };
+    ImGui::SetNextItemWidth(120);
+    ImGui::Combo("##fuzzyMode", &m_fuzzyModeIndex, kFuzzyModes, IM_ARRAYSIZE(kFuzzyModes));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(110);
+    ImGui::InputDouble("##fuzzyA", &m_fuzzyValueA, 0.0, 0.0, "%g");
+    if (m_fuzzyModeIndex == 0) {
+        ImGui::SameLine();
+        ImGui::TextUnformatted("and");
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(110);
+        ImGui::InputDouble("##fuzzyB", &m_fuzzyValueB, 0.0, 0.0, "%g");
+    } else if (m_fuzzyModeIndex == 1) {
+        ImGui::SameLine();
+        ImGui::TextUnformatted("+/-");
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(110);
+        ImGui::InputDouble("##fuzzyTol", &m_fuzzyValueB, 0.0, 0.0, "%g");
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Filter by Value")) {
+        double low = 0.0;
+        double high = 0.0;
+        switch (m_fuzzyModeIndex) {
+        case 0:
+            low = std::min(m_fuzzyValueA, m_fuzzyValueB);
+            high = std::max(m_fuzzyValueA, m_fuzzyValueB);
+            break;
+        case 1:
+            low = m_fuzzyValueA - std::abs(m_fuzzyValueB);
+            high = m_fuzzyValueA + std::abs(m_fuzzyValueB);
+            break;
+        default:
+            // [x, x+1) as an inclusive interval.
+            low = m_fuzzyValueA;
+            high = std::nextafter(m_fuzzyValueA + 1.0, m_fuzzyValueA);
+            break;
+        }
+        memoryScanner.startValueFilterAsync(low, high);
+    }
+
+    ImGui::Text("Candidates: %zu", memoryScanner.candidateCount());
+
+    const std::vector<uintptr_t> top = memoryScanner.topCandidates();
+    if (!top.empty()) {
+        ImGui::InputDouble("Freeze value", &m_freezeValue, 0.0, 0.0, "%g");
+        ImGui::BeginChild("ScanResults", ImVec2(0, 160), true);
+        for (uintptr_t address : top) {
+            char label[32];
+            std::snprintf(label, sizeof(label), "0x%llX", static_cast<unsigned long long>(address));
+            ImGui::PushID(label);
+            if (ImGui::Selectable(label, false, ImGuiSelectableFlags_None, ImVec2(160, 0))) {
+                if (m_confirmOwnership) {
+                    // The payload is encoded as the session's value type, so a
+                    // Double session freezes 8 float bytes, an Int8 session one.
+                    uint8_t payload[8];
+                    const size_t payloadSize = encodeScanValue(memoryScanner.sessionValueType(), m_freezeValue, payload);
+                    FreezeService::instance().freeze("manual", address, payload, payloadSize);
+                    util::Logger::instance().log(util::Logger::Level::Info, "Froze " + std::string(label));
+                } else {
+                    util::Logger::instance().log(util::Logger::Level::Warning, "Ownership confirmation required before freezing values");
+                }
+            }
+            // Chain search snapshots the whole target and builds the pointer
+            // map on the scan worker thread; results appear below when done.
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Find Chains")) {
+                memoryScanner.startChainSearchAsync(address, processManager.modules());
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndChild();
+    }
+
+    const std::vector<PointerChain> chains = memoryScanner.chainResults();
+    if (!chains.empty()) {
+        ImGui::Text("Pointer Chains (click to save to config)");
+        ImGui::BeginChild("ChainResults", ImVec2(0, 120), true);
+        for (size_t i = 0; i < chains.size(); ++i) {
+            const std::string text = formatChain(chains[i]);
+            ImGui::PushID(static_cast<int>(i));
+            if (ImGui::Selectable(text.c_str())) {
+                if (auto processName = processManager.currentProcessName()) {
+                    // Merge into the existing config so saved chains accumulate
+                    // and re-resolve automatically at the next (re)attach.
+                    ProcessConfig config = configManager.load(*processName).value_or(ProcessConfig{});
+                    char chainName[32];
+                    std::snprintf(chainName, sizeof(chainName), "chain_%zu", config.chains.size());
+                    config.chains[chainName] = text;
+                    configManager.save(*processName, config);
+                    util::Logger::instance().log(util::Logger::Level::Info,
+                        "Saved pointer chain " + std::string(chainName) + ": " + text);
+                } else {
+                    util::Logger::instance().log(util::Logger::Level::Warning, "Attach to a process before saving chains");
+                }
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndChild();
+    }
 }
 
 void GUIManager::drawModsTab(ModManager& modManager) {
@@ -127,11 +438,17 @@ void GUIManager::drawModsTab(ModManager& modManager) {
 }
 
 void GUIManager::drawProcessTab(ProcessManager& processManager) {
+    // The watcher keeps the list current in the background; copy it only
+    // when its version moves, never per frame.
     static std::vector<ProcessInfo> cachedProcesses;
-    if (ImGui::Button("Refresh Processes")) {
-        cachedProcesses = processManager.enumerate();
+    static uint64_t cachedVersion = UINT64_MAX;
+    const uint64_t version = processManager.processListVersion();
+    if (cachedVersion != version) {
+        cachedProcesses = processManager.processList();
+        cachedVersion = version;
     }
 
+    ImGui::TextDisabled("Process list refreshes automatically.");
     ImGui::SameLine();
     if (ImGui::Button("Detach")) {
         processManager.detach();
@@ -171,11 +488,31 @@ void GUIManager::drawProcessTab(ProcessManager& processManager) {
 }
 
 void GUIManager::drawLogTab() {
+    ImGui::SetNextItemWidth(240);
+    if (ImGui::InputTextWithHint("##logFilter", "Filter (case-insensitive)", m_logFilter, sizeof(m_logFilter))) {
+        rebuildLogFilter();
+    }
+
     ImGui::BeginChild("LogPane", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar);
     ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[0]);
-    for (const auto& line : m_logBuffer) {
-        ImGui::TextUnformatted(line.c_str());
+
+    // Only the visible rows are submitted; the clipper advances by line height,
+    // so per-frame cost tracks the pane size rather than the session length.
+    std::lock_guard<std::mutex> lock(m_logMutex);
+    const bool filtered = !m_logFilterActive.empty();
+    const uint64_t oldest = m_logCount > kLogCapacity ? m_logCount - kLogCapacity : 0;
+    const int total = filtered ? static_cast<int>(m_logFiltered.size())
+                               : static_cast<int>(m_logCount - oldest);
+
+    ImGuiListClipper clipper;
+    clipper.Begin(total);
+    while (clipper.Step()) {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+            const uint64_t seq = filtered ? m_logFiltered[static_cast<size_t>(i)] : oldest + static_cast<uint64_t>(i);
+            ImGui::TextUnformatted(m_logLines[seq % kLogCapacity].c_str());
+        }
     }
+
     if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
         ImGui::SetScrollHereY(1.0f);
     }
@@ -183,6 +520,109 @@ void GUIManager::drawLogTab() {
     ImGui::EndChild();
 }
 
+void GUIManager::drawPerfTab(ModManager& modManager) {
+    const ImGuiIO& io = ImGui::GetIO();
+    ImGui::Text("Frame: %.2f ms (%.0f FPS)", 1000.0f / io.Framerate, io.Framerate);
+
+    // Counters are monotonic; rates come from deltas over a ~1 s window so the
+    // numbers are readable instead of flickering every frame.
+    static uint64_t previousCounters[static_cast<size_t>(PerfMonitor::Counter::Count)] = {};
+    static double rates[static_cast<size_t>(PerfMonitor::Counter::Count)] = {};
+    static auto lastSample = std::chrono::steady_clock::now();
+    const auto now = std::chrono::steady_clock::now();
+    const double windowSeconds = std::chrono::duration<double>(now - lastSample).count();
+    if (windowSeconds >= 1.0) {
+        for (size_t i = 0; i < static_cast<size_t>(PerfMonitor::Counter::Count); ++i) {
+            const uint64_t value = PerfMonitor::instance().counter(static_cast<PerfMonitor::Counter>(i));
+            rates[i] = static_cast<double>(value - previousCounters[i]) / windowSeconds;
+            previousCounters[i] = value;
+        }
+        lastSample = now;
+    }
+
+    ImGui::Text("Scan throughput: %.1f MiB/s", rates[static_cast<size_t>(PerfMonitor::Counter::ScanBytes)] / (1024.0 * 1024.0));
+    ImGui::Text("Freeze syscalls: %.0f reads/s, %.0f writes/s",
+        rates[static_cast<size_t>(PerfMonitor::Counter::FreezeReads)],
+        rates[static_cast<size_t>(PerfMonitor::Counter::FreezeWrites)]);
+    ImGui::Text("Plugin batch reads: %.0f/s", rates[static_cast<size_t>(PerfMonitor::Counter::PluginReads)]);
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Subsystem timings");
+
+    static const char* const kSectionNames[static_cast<size_t>(PerfMonitor::Section::Count)] = {
+        "Frame", "Scan pass", "Freeze cycle", "Mod tick", "Plugin batch"
+    };
+
+    if (ImGui::BeginTable("PerfSections", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Section");
+        ImGui::TableSetupColumn("Last");
+        ImGui::TableSetupColumn("Avg");
+        ImGui::TableSetupColumn("Distribution (log2 us)");
+        ImGui::TableHeadersRow();
+
+        for (size_t i = 0; i < static_cast<size_t>(PerfMonitor::Section::Count); ++i) {
+            const auto& stats = PerfMonitor::instance().section(static_cast<PerfMonitor::Section>(i));
+            const uint64_t count = stats.count.load(std::memory_order_relaxed);
+            const uint64_t total = stats.totalMicros.load(std::memory_order_relaxed);
+            const uint64_t last = stats.lastMicros.load(std::memory_order_relaxed);
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(kSectionNames[i]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f ms", static_cast<double>(last) / 1000.0);
+            ImGui::TableNextColumn();
+            if (count > 0) {
+                ImGui::Text("%.2f ms", static_cast<double>(total) / static_cast<double>(count) / 1000.0);
+            } else {
+                ImGui::TextDisabled("-");
+            }
+            ImGui::TableNextColumn();
+            float buckets[PerfMonitor::kHistogramBuckets];
+            for (size_t b = 0; b < PerfMonitor::kHistogramBuckets; ++b) {
+                buckets[b] = static_cast<float>(stats.buckets[b].load(std::memory_order_relaxed));
+            }
+            ImGui::PushID(static_cast<int>(i));
+            ImGui::PlotHistogram("##hist", buckets, PerfMonitor::kHistogramBuckets, 0, nullptr,
+                                 0.0f, FLT_MAX, ImVec2(-1, 28));
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Per-mod tick cost");
+
+    const auto& tickStats = modManager.tickStats();
+    const auto& mods = modManager.mods();
+    if (ImGui::BeginTable("PerfMods", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Mod");
+        ImGui::TableSetupColumn("Last");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableSetupColumn("Ticks");
+        ImGui::TableSetupColumn("Deferrals");
+        ImGui::TableHeadersRow();
+
+        for (size_t i = 0; i < mods.size() && i < tickStats.size(); ++i) {
+            if (!mods[i]) {
+                continue;
+            }
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(mods[i]->getName());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f ms", tickStats[i].lastTickMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f ms", tickStats[i].maxTickMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(tickStats[i].ticks));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(tickStats[i].deferrals));
+        }
+        ImGui::EndTable();
+    }
+}
+
 void GUIManager::drawSettingsTab(ConfigManager& configManager, ProcessManager& processManager, ModManager& modManager) {
     if (!processManager.isAttached()) {
         ImGui::TextDisabled("Attach to a process to manage configs.");
@@ -204,7 +644,9 @@ void GUIManager::drawSettingsTab(ConfigManager& configManager, ProcessManager& p
 
     ImGui::SameLine();
     if (ImGui::Button("Save Config")) {
-        ProcessConfig cfg;
+        // Merge into the stored config: this button only owns the mod enable
+        // states, and must not wipe saved addresses, signatures or chains.
+        ProcessConfig cfg = configManager.load(processName).value_or(ProcessConfig{});
         for (auto& mod : modManager.mods()) {
             if (mod) {
                 cfg.mods[mod->getName()] = ModState{ mod->isEnabled() };
@@ -220,7 +662,10 @@ void GUIManager::drawSettingsTab(ConfigManager& configManager, ProcessManager& p
     }
 }
 
-void GUIManager::drawStatusBar() {
+void GUIManager::drawStatusBar(MemoryScanner& memoryScanner) {
+    m_isScanning = memoryScanner.isScanning();
+    m_scanProgress = memoryScanner.scanProgress();
+
     ImGui::Separator();
     ImGui::Text("Status: %s", m_statusText.c_str());
     ImGui::SameLine();
@@ -8,13 +8,17 @@
 #include <d3d11.h>
 #include <wrl/client.h>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
 class GUIManager {
 public:
     GUIManager();
+    ~GUIManager();
 
     void initialize(HWND hwnd, ID3D11Device* device, ID3D11DeviceContext* context);
     void shutdown();
@@ -26,16 +30,25 @@ public:
 
     bool shouldClose() const { return m_shouldClose; }
 
+    //! Bumps whenever displayed content changes outside the input path (log
+    //! appends for now); the main loop skips redraws while it holds still.
+    uint64_t contentVersion() const { return m_contentVersion.load(std::memory_order_relaxed); }
+
 private:
-    void drawHomeTab();
+    void drawHomeTab(ProcessManager& processManager, MemoryScanner& memoryScanner, ConfigManager& configManager);
     void drawModsTab(ModManager& modManager);
     void drawProcessTab(ProcessManager& processManager);
     void drawLogTab();
+    void drawPerfTab(ModManager& modManager);
     void drawSettingsTab(ConfigManager& configManager, ProcessManager& processManager, ModManager& modManager);
-    void drawStatusBar();
+    void drawStatusBar(MemoryScanner& memoryScanner);
 
     void showDisclaimerModal();
 
+    //! Appends a line to the log ring; called from the logger's flusher thread.
+    void appendLogLine(const std::string& line);
+    void rebuildLogFilter();
+
     bool m_initialized = false;
     bool m_shouldClose = false;
     bool m_disclaimerAccepted = false;
@@ -44,7 +57,29 @@ private:
     std::string m_statusText = "Ready";
     float m_scanProgress = 0.0f;
     bool m_isScanning = false;
+    double m_freezeValue = 100.0;
+    int m_scanValueTypeIndex = 2; // ScanValueType::Int32
+    int m_fuzzyModeIndex = 0;
+    double m_fuzzyValueA = 0.0;
+    double m_fuzzyValueB = 0.0;
+    int m_needleKindIndex = 0;
+    char m_needleText[160] = {};
+    //! Signature of the last launched byte search; freezing a match re-writes
+    //! these bytes so the string or pattern stays pinned.
+    ByteSignature m_searchSignature;
 
-    std::vector<std::string> m_logBuffer;
+    //! Fixed-capacity ring of log lines. Line i of the session lives in slot
+    //! i % kLogCapacity; once the ring is full the oldest lines fall away, so
+    //! the Log tab's memory and worst-case filter cost stay bounded.
+    static constexpr size_t kLogCapacity = 4096;
+    std::mutex m_logMutex;
+    std::vector<std::string> m_logLines;
+    uint64_t m_logCount = 0;
+    //! Sequence numbers of lines matching the active filter, maintained
+    //! incrementally as lines arrive; rebuilt only when the filter changes.
+    std::vector<uint64_t> m_logFiltered;
+    std::string m_logFilterActive;
+    char m_logFilter[128] = {};
+    std::atomic<uint64_t> m_contentVersion{0};
 };
 
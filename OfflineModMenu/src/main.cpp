@@ -5,6 +5,7 @@
 #include "gui.hpp"
 #include "process.hpp"
 #include "memory.hpp"
+#include "freeze_service.hpp"
 #include "config.hpp"
 #include "utils.hpp"
 #include "mods/mod_manager.hpp"
@@ -14,6 +15,7 @@
 #include <backends/imgui_impl_dx11.h>
 
 #include <wrl/client.h>
+#include <chrono>
 #include <filesystem>
 
 // DirectX objects
@@ -67,8 +69,27 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
 
     MSG msg = {};
     bool done = false;
+    uint64_t attachVersionSeen = processManager.attachVersion();
+
+    // On-demand rendering: the loop blocks on window messages with a timeout
+    // and only rebuilds/presents when something could have changed on screen —
+    // input arrived, a tracked content version moved, a scan is publishing
+    // progress, or the periodic refresh is due. Minimized drops to a low tick
+    // with no rendering at all; mod ticks and the freeze/scan threads keep
+    // running throughout, so the idle menu costs the game essentially nothing.
+    constexpr DWORD kIdleWaitMs = 100;
+    constexpr DWORD kMinimizedWaitMs = 250;
+    constexpr std::chrono::milliseconds kForcedRefreshInterval{500};
+    uint64_t renderedStateVersion = UINT64_MAX;
+    auto lastRender = std::chrono::steady_clock::now() - kForcedRefreshInterval;
+
     while (!done) {
+        const bool minimized = IsIconic(g_hwnd) != FALSE;
+        MsgWaitForMultipleObjects(0, nullptr, FALSE, minimized ? kMinimizedWaitMs : kIdleWaitMs, QS_ALLINPUT);
+
+        bool sawMessage = false;
         while (PeekMessage(&msg, nullptr, 0U, 0U, PM_REMOVE)) {
+            sawMessage = true;
             TranslateMessage(&msg);
             DispatchMessage(&msg);
             if (msg.message == WM_QUIT) {
@@ -80,9 +101,56 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
             break;
         }
 
-        if (processManager.isAttached()) {
-            memoryScanner.setProcess(processManager.handle());
+        // Detects target exit and reattaches automatically once the watcher
+        // spots a new instance; transitions are rewired exactly once below.
+        processManager.pollTarget();
+
+        const uint64_t attachVersion = processManager.attachVersion();
+        if (attachVersion != attachVersionSeen) {
+            attachVersionSeen = attachVersion;
+            if (processManager.isAttached()) {
+                memoryScanner.setProcess(processManager.handle());
+                FreezeService::instance().setProcess(processManager.handle());
+                modManager.attachAll(processManager.handle(), *processManager.currentProcessName());
+                // Re-resolve configured signatures immediately so mods get
+                // their addresses back without a manual scan after a restart.
+                if (auto config = configManager.load(*processManager.currentProcessName())) {
+                    modManager.resolveAddresses(memoryScanner, processManager, *config);
+                }
+            } else {
+                memoryScanner.setProcess(nullptr);
+                FreezeService::instance().setProcess(nullptr);
+                // Mods drop their own freeze entries in onDetach; the GUI's
+                // manual freezes are cleared here so a reattached instance is
+                // never written at the old process's addresses.
+                FreezeService::instance().clearOwner("manual");
+                modManager.detachAll();
+            }
+        }
+
+        // Mods tick regardless of whether a frame is drawn; the freeze service
+        // runs on its own thread anyway.
+        modManager.tick();
+
+        if (minimized) {
+            continue;
+        }
+
+        // Cheap fingerprint of everything the UI displays from background
+        // state; while it holds still and no input arrived, skip the frame.
+        const uint64_t stateVersion = gui.contentVersion()
+            + processManager.attachVersion() * 1000003u
+            + processManager.processListVersion() * 10007u
+            + memoryScanner.candidateCount() * 101u
+            + memoryScanner.searchResultCount() * 31u
+            + memoryScanner.chainResultCount() * 13u;
+        const auto now = std::chrono::steady_clock::now();
+        const bool refreshDue = now - lastRender >= kForcedRefreshInterval;
+        if (!sawMessage && !memoryScanner.isScanning() && stateVersion == renderedStateVersion && !refreshDue) {
+            continue;
         }
+        renderedStateVersion = stateVersion;
+        lastRender = now;
 
         const float clearColorWithAlpha[4] = { 0.05f, 0.05f, 0.07f, 1.0f };
         g_pd3dDeviceContext->OMSetRenderTargets(1, g_mainRenderTargetView.GetAddressOf(), nullptr);
@@ -0,0 +1,127 @@
+#include "mapped_buffer.hpp"
+
+#include "utils.hpp"
+
+#include <array>
+#include <utility>
+
+MappedFileBuffer::~MappedFileBuffer() {
+    reset();
+}
+
+MappedFileBuffer::MappedFileBuffer(MappedFileBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFileBuffer& MappedFileBuffer::operator=(MappedFileBuffer&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_file = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+        m_view = std::exchange(other.m_view, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+bool MappedFileBuffer::create(size_t size) {
+    reset();
+    if (size == 0) {
+        return false;
+    }
+
+    std::array<wchar_t, MAX_PATH> tempDir{};
+    std::array<wchar_t, MAX_PATH> tempFile{};
+    if (!GetTempPathW(static_cast<DWORD>(tempDir.size()), tempDir.data()) ||
+        !GetTempFileNameW(tempDir.data(), L"omm", 0, tempFile.data())) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to allocate temp file for mapped buffer");
+        return false;
+    }
+
+    m_file = CreateFileW(tempFile.data(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                         FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to create mapped buffer backing file");
+        return false;
+    }
+
+    LARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = static_cast<LONGLONG>(size);
+    m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE,
+                                   static_cast<DWORD>(mappingSize.HighPart), mappingSize.LowPart, nullptr);
+    if (!m_mapping) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to create file mapping for mapped buffer");
+        reset();
+        return false;
+    }
+
+    m_view = MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!m_view) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to map view for mapped buffer");
+        reset();
+        return false;
+    }
+
+    m_size = size;
+    return true;
+}
+
+bool MappedFileBuffer::openExisting(const wchar_t* path) {
+    reset();
+
+    // Read sharing keeps the file inspectable while the session holds it; the
+    // mapping still blocks concurrent writers, which is what we want.
+    m_file = CreateFileW(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to open mapped buffer file");
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart <= 0) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to size mapped buffer file");
+        reset();
+        return false;
+    }
+
+    m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    if (!m_mapping) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to create file mapping for mapped buffer");
+        reset();
+        return false;
+    }
+
+    m_view = MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!m_view) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to map view for mapped buffer");
+        reset();
+        return false;
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+bool MappedFileBuffer::flush() {
+    if (!m_view) {
+        return false;
+    }
+    return FlushViewOfFile(m_view, 0) != 0;
+}
+
+void MappedFileBuffer::reset() {
+    if (m_view) {
+        UnmapViewOfFile(m_view);
+        m_view = nullptr;
+    }
+    if (m_mapping) {
+        CloseHandle(m_mapping);
+        m_mapping = nullptr;
+    }
+    if (m_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_file);
+        m_file = INVALID_HANDLE_VALUE;
+    }
+    m_size = 0;
+}
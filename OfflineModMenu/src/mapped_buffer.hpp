@@ -0,0 +1,45 @@
+#pragma once
+
+#include <windows.h>
+
+#include <cstddef>
+#include <cstdint>
+
+//! Writable buffer backed by a delete-on-close temp file mapping.
+//!
+//! Used for scan baselines that exceed RAM comfort: the OS pages cold parts out
+//! to the temp file instead of the commit charge sitting in our working set.
+class MappedFileBuffer {
+public:
+    MappedFileBuffer() = default;
+    ~MappedFileBuffer();
+
+    MappedFileBuffer(const MappedFileBuffer&) = delete;
+    MappedFileBuffer& operator=(const MappedFileBuffer&) = delete;
+    MappedFileBuffer(MappedFileBuffer&& other) noexcept;
+    MappedFileBuffer& operator=(MappedFileBuffer&& other) noexcept;
+
+    //! Creates a temp file of the given size and maps it read/write.
+    bool create(size_t size);
+
+    //! Maps an existing file read/write in its entirety. The file persists
+    //! after reset(); used for resumable scan session files.
+    bool openExisting(const wchar_t* path);
+
+    //! Flushes dirty view pages to the backing file. Only meaningful for
+    //! openExisting() buffers, where the file outlives the mapping.
+    bool flush();
+
+    //! Unmaps and deletes the backing file.
+    void reset();
+
+    uint8_t* data() const { return static_cast<uint8_t*>(m_view); }
+    size_t size() const { return m_size; }
+    bool valid() const { return m_view != nullptr; }
+
+private:
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+    void* m_view = nullptr;
+    size_t m_size = 0;
+};
@@ -1,16 +1,139 @@
 #include "memory.hpp"
 
+#include "perf.hpp"
+#include "pointer_map.hpp"
+#include "scan_kernels.hpp"
 #include "utils.hpp"
+#include "worker_pool.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+namespace {
+constexpr DWORD kWritableProtectMask = PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+
+constexpr size_t kHashPageBytes = 4096;
+
+//! FNV-1a over 8-byte strides — cheap enough to hash every page read during a
+//! pass. A collision is not benign: refinement short-circuits pages whose hash
+//! is unchanged, so a colliding changed page is treated as clean — every
+//! candidate on it is misclassified and its baseline refresh is skipped. With
+//! 64 bits that is astronomically unlikely, which is the bet this makes.
+uint64_t hashPage(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t block = 0;
+        std::memcpy(&block, data + i, sizeof(block));
+        hash = (hash ^ block) * 1099511628211ull;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// On-disk layout of a saved scan session. Every section offset is derivable
+// from the header and region table, so resuming needs no parsing — just a
+// mapping and pointer arithmetic.
+constexpr uint32_t kSessionMagic = 0x53534D4F; // "OMSS"
+constexpr uint32_t kSessionVersion = 1;
+constexpr size_t kSessionDataAlign = 4096;
+
+struct SessionFileHeader {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t valueType = 0;
+    uint32_t reserved = 0;
+    uint64_t regionCount = 0;
+    uint64_t dataOffset = 0;
+    uint64_t dataBytes = 0;
+};
+
+struct SessionFileRegion {
+    uint64_t base = 0;
+    uint64_t size = 0;
+};
+
+inline size_t sessionPageCount(size_t regionSize) {
+    return (regionSize + kHashPageBytes - 1) / kHashPageBytes;
+}
+
+inline size_t sessionWordCount(size_t regionSize, size_t slotBytes) {
+    return (regionSize / slotBytes + 63) / 64;
+}
+
+//! Anchors a signature search on its rarest fixed byte: padding and zero
+//! bytes saturate memory, so keying the SIMD scan on them would verify
+//! nearly every position. Returns false when no fixed byte exists.
+bool chooseAnchor(ByteSignature& signature) {
+    auto rarityScore = [](uint8_t value) {
+        switch (value) {
+        case 0x00: case 0xFF: return 3;
+        case 0xCC: case 0x90: return 2; // int3 / nop padding
+        case 0x48: case 0x8B: case 0xE8: return 1; // ubiquitous x64 opcode bytes
+        default: return 0;
+        }
+    };
+
+    bool haveAnchor = false;
+    int bestScore = 4;
+    for (size_t byteIndex = 0; byteIndex < signature.bytes.size(); ++byteIndex) {
+        if (signature.mask[byteIndex] == 0) {
+            continue;
+        }
+        const int score = rarityScore(signature.bytes[byteIndex]);
+        if (!haveAnchor || score < bestScore) {
+            signature.anchor = byteIndex;
+            bestScore = score;
+            haveAnchor = true;
+        }
+    }
+    return haveAnchor;
+}
+
+std::vector<uint64_t> hashRegionPages(const uint8_t* data, size_t size) {
+    std::vector<uint64_t> hashes;
+    hashes.reserve((size + kHashPageBytes - 1) / kHashPageBytes);
+    for (size_t offset = 0; offset < size; offset += kHashPageBytes) {
+        hashes.push_back(hashPage(data + offset, std::min(kHashPageBytes, size - offset)));
+    }
+    return hashes;
+}
+} // namespace
+
+std::optional<size_t> FullSnapshot::offsetOf(uintptr_t address) const {
+    // Regions are sorted, so binary-search for the last region starting at or below the address.
+    auto it = std::upper_bound(regions.begin(), regions.end(), address, [](uintptr_t addr, const MemoryRegion& region) {
+        return addr < region.base;
+    });
+    if (it == regions.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    if (address >= it->base + it->size) {
+        return std::nullopt;
+    }
+    const size_t index = static_cast<size_t>(it - regions.begin());
+    return regionOffsets[index] + (address - it->base);
+}
 
 MemoryScanner::MemoryScanner(HANDLE process)
     : m_process(process) {
 }
 
 MemoryScanner::~MemoryScanner() {
-    clearFreezes();
+    cancelScan();
+    if (m_scanThread.joinable()) {
+        m_scanThread.join();
+    }
 }
 
 void MemoryScanner::setProcess(HANDLE process) {
@@ -58,91 +181,1136 @@ std::optional<MemorySnapshot> MemoryScanner::takeSnapshot(uintptr_t base, size_t
     return snapshot;
 }
 
-std::vector<uintptr_t> MemoryScanner::compareSnapshots(const MemorySnapshot& previous, const MemorySnapshot& current, int expectedDelta) {
-    std::vector<uintptr_t> results;
+std::vector<MemoryRegion> MemoryScanner::queryWritableRegions() const {
+    std::vector<MemoryRegion> regions;
+    if (!m_process) {
+        return regions;
+    }
+
+    SYSTEM_INFO systemInfo{};
+    GetSystemInfo(&systemInfo);
+    const uintptr_t maxAddress = reinterpret_cast<uintptr_t>(systemInfo.lpMaximumApplicationAddress);
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(systemInfo.lpMinimumApplicationAddress);
+    MEMORY_BASIC_INFORMATION mbi{};
+    while (address < maxAddress && VirtualQueryEx(m_process, reinterpret_cast<LPCVOID>(address), &mbi, sizeof(mbi)) == sizeof(mbi)) {
+        const bool committed = mbi.State == MEM_COMMIT;
+        const bool privateHeap = mbi.Type == MEM_PRIVATE;
+        const bool writable = (mbi.Protect & kWritableProtectMask) != 0;
+        const bool guarded = (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) != 0;
 
-    size_t count = std::min(previous.data.size(), current.data.size());
-    for (size_t i = 0; i + sizeof(int) <= count; i += sizeof(int)) {
-        int prevValue = *reinterpret_cast<const int*>(&previous.data[i]);
-        int currValue = *reinterpret_cast<const int*>(&current.data[i]);
-        if (currValue - prevValue == expectedDelta) {
-            results.push_back(previous.base + static_cast<uintptr_t>(i));
+        if (committed && privateHeap && writable && !guarded) {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(mbi.BaseAddress);
+            // Merge with the previous region when they are contiguous so the snapshot
+            // pass issues one large read instead of thousands of small ones.
+            if (!regions.empty() && regions.back().base + regions.back().size == base) {
+                regions.back().size += mbi.RegionSize;
+            } else {
+                regions.push_back(MemoryRegion{ base, mbi.RegionSize });
+            }
         }
+
+        address = reinterpret_cast<uintptr_t>(mbi.BaseAddress) + mbi.RegionSize;
     }
 
-    util::Logger::instance().log(util::Logger::Level::Info, "compareSnapshots narrowed to " + std::to_string(results.size()) + " candidates");
-    return results;
+    return regions;
+}
+
+std::optional<FullSnapshot> MemoryScanner::takeFullSnapshot() {
+    if (!m_process) {
+        return std::nullopt;
+    }
+
+    std::vector<MemoryRegion> regions = queryWritableRegions();
+    if (regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Full snapshot found no writable private regions");
+        return std::nullopt;
+    }
+
+    size_t totalBytes = 0;
+    for (const auto& region : regions) {
+        totalBytes += region.size;
+    }
+
+    FullSnapshot snapshot;
+    snapshot.regions.reserve(regions.size());
+    snapshot.regionOffsets.reserve(regions.size());
+    snapshot.data.resize(totalBytes);
+
+    size_t writeOffset = 0;
+    for (const auto& region : regions) {
+        const size_t captured = readRegionBytes(region, snapshot.data.data() + writeOffset);
+        if (captured == 0) {
+            continue;
+        }
+
+        snapshot.regions.push_back(MemoryRegion{ region.base, captured });
+        snapshot.regionOffsets.push_back(writeOffset);
+        writeOffset += captured;
+    }
+
+    snapshot.data.resize(writeOffset);
+
+    if (snapshot.regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Full snapshot failed: no region could be read");
+        return std::nullopt;
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Full snapshot captured " + std::to_string(snapshot.regions.size()) + " regions, " + std::to_string(writeOffset / (1024 * 1024)) + " MiB");
+    return snapshot;
+}
+
+std::vector<MemoryRegion> MemoryScanner::queryImageRegions() const {
+    std::vector<MemoryRegion> regions;
+    if (!m_process) {
+        return regions;
+    }
+
+    SYSTEM_INFO systemInfo{};
+    GetSystemInfo(&systemInfo);
+    const uintptr_t maxAddress = reinterpret_cast<uintptr_t>(systemInfo.lpMaximumApplicationAddress);
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(systemInfo.lpMinimumApplicationAddress);
+    MEMORY_BASIC_INFORMATION mbi{};
+    while (address < maxAddress && VirtualQueryEx(m_process, reinterpret_cast<LPCVOID>(address), &mbi, sizeof(mbi)) == sizeof(mbi)) {
+        const bool committed = mbi.State == MEM_COMMIT;
+        const bool image = mbi.Type == MEM_IMAGE;
+        const bool readable = (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) == 0 && mbi.Protect != 0;
+
+        if (committed && image && readable) {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(mbi.BaseAddress);
+            // Merge adjacent sections of the same module so a signature that
+            // straddles a section boundary is still found.
+            if (!regions.empty() && regions.back().base + regions.back().size == base) {
+                regions.back().size += mbi.RegionSize;
+            } else {
+                regions.push_back(MemoryRegion{ base, mbi.RegionSize });
+            }
+        }
+
+        address = reinterpret_cast<uintptr_t>(mbi.BaseAddress) + mbi.RegionSize;
+    }
+
+    return regions;
+}
+
+std::vector<uintptr_t> MemoryScanner::findSignature(const ByteSignature& signature) const {
+    std::vector<uintptr_t> matches;
+    if (signature.empty() || !m_process) {
+        return matches;
+    }
+
+    const std::vector<MemoryRegion> regions = queryImageRegions();
+    if (regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Signature scan found no image regions");
+        return matches;
+    }
+
+    // One chunk per region: image regions are few and large, so this is enough
+    // for the pool to spread the work while keeping results region-ordered.
+    std::vector<std::vector<uintptr_t>> regionResults(regions.size());
+    WorkerPool::instance().parallelFor(regions.size(), [&](size_t index) {
+        const MemoryRegion& region = regions[index];
+        std::vector<uint8_t> buffer(region.size);
+        const size_t captured = readRegionBytes(region, buffer.data());
+        if (captured < signature.bytes.size()) {
+            return;
+        }
+        scan::patternSearch(buffer.data(), captured, signature.bytes.data(), signature.mask.data(),
+                            signature.bytes.size(), signature.anchor, region.base, regionResults[index]);
+    });
+
+    // Regions are ascending and each kernel appends in order, so plain
+    // concatenation keeps the matches sorted.
+    for (const auto& local : regionResults) {
+        matches.insert(matches.end(), local.begin(), local.end());
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Signature scan matched " + std::to_string(matches.size()) + " locations across " + std::to_string(regions.size()) + " image regions");
+    return matches;
 }
 
-std::vector<uintptr_t> MemoryScanner::filterCandidates(const std::vector<uintptr_t>& candidates, int expectedValue) {
-    std::vector<uintptr_t> filtered;
-    filtered.reserve(candidates.size());
+std::vector<uintptr_t> MemoryScanner::searchBytes(const ByteSignature& signature) const {
+    std::vector<uintptr_t> matches;
+    if (signature.empty() || !m_process) {
+        return matches;
+    }
+
+    const std::vector<MemoryRegion> regions = queryWritableRegions();
+    if (regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Byte search found no writable private regions");
+        return matches;
+    }
 
-    for (uintptr_t address : candidates) {
-        int value = 0;
-        if (read(address, &value, sizeof(value)) && value == expectedValue) {
-            filtered.push_back(address);
+    // Writable regions can be huge, so unlike findSignature this splits them
+    // into fixed chunks for the pool. Each chunk reads `patternSize - 1` bytes
+    // past its end so matches straddling a boundary are still found; the kernel
+    // only reports start positions inside the chunk proper, so the overlap
+    // never duplicates a match.
+    constexpr size_t kChunkBytes = 4u * 1024 * 1024;
+    const size_t patternSize = signature.bytes.size();
+    struct SearchJob {
+        uintptr_t base = 0;
+        size_t size = 0;
+    };
+    std::vector<SearchJob> jobs;
+    for (const auto& region : regions) {
+        for (size_t offset = 0; offset < region.size; offset += kChunkBytes) {
+            const size_t chunkSize = std::min(kChunkBytes, region.size - offset);
+            const size_t overlap = std::min(patternSize - 1, region.size - offset - chunkSize);
+            jobs.push_back(SearchJob{ region.base + offset, chunkSize + overlap });
         }
     }
 
-    util::Logger::instance().log(util::Logger::Level::Info, "filterCandidates resulted in " + std::to_string(filtered.size()) + " matches");
-    return filtered;
+    std::vector<std::vector<uintptr_t>> jobResults(jobs.size());
+    WorkerPool::instance().parallelFor(jobs.size(), [&](size_t index) {
+        const SearchJob& job = jobs[index];
+        std::vector<uint8_t> buffer(job.size);
+        const size_t captured = readRegionBytes(MemoryRegion{ job.base, job.size }, buffer.data());
+        if (captured < patternSize) {
+            return;
+        }
+        PerfMonitor::instance().add(PerfMonitor::Counter::ScanBytes, captured);
+        scan::patternSearch(buffer.data(), captured, signature.bytes.data(), signature.mask.data(),
+                            patternSize, signature.anchor, job.base, jobResults[index]);
+    });
+
+    // Jobs are ascending and each kernel appends in order, so plain
+    // concatenation keeps the matches sorted. No duplicates either: a match
+    // must fit within the buffer, so its start lies before the overlap, and
+    // the next job begins exactly at the chunk boundary.
+    for (const auto& local : jobResults) {
+        matches.insert(matches.end(), local.begin(), local.end());
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Byte search matched " + std::to_string(matches.size()) + " locations across " + std::to_string(regions.size()) + " writable regions");
+    return matches;
+}
+
+bool MemoryScanner::startByteSearchAsync(const ByteSignature& signature) {
+    if (signature.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Refusing to start a byte search with an empty signature");
+        return false;
+    }
+    return startScanJob([this, signature]() {
+        ScopedPerfTimer passTimer(PerfMonitor::Section::ScanPass);
+        std::vector<uintptr_t> matches = searchBytes(signature);
+        m_searchResultCount.store(matches.size());
+
+        // Cap the published list like topCandidates: the GUI copies it every
+        // frame, and a short needle can match millions of locations.
+        constexpr size_t kMaxSearchResults = 256;
+        if (matches.size() > kMaxSearchResults) {
+            matches.resize(kMaxSearchResults);
+        }
+        std::lock_guard<std::mutex> lock(m_resultsMutex);
+        m_searchResults = std::move(matches);
+    });
+}
+
+std::vector<uintptr_t> MemoryScanner::searchResults() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_searchResults;
 }
 
-void MemoryScanner::freezeValue(uintptr_t address, const void* buffer, size_t size) {
-    std::lock_guard<std::mutex> lock(m_freezeMutex);
-    auto it = std::find_if(m_freezeEntries.begin(), m_freezeEntries.end(), [address](const FreezeEntry& entry) {
-        return entry.address == address;
+bool MemoryScanner::startChainSearchAsync(uintptr_t target, std::vector<ModuleRegion> modules) {
+    if (!m_process) {
+        return false;
+    }
+    if (modules.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Chain search needs the target's module map");
+        return false;
+    }
+    return startScanJob([this, target, modules = std::move(modules)]() {
+        ScopedPerfTimer passTimer(PerfMonitor::Section::ScanPass);
+
+        // Depth and offset bounds match what game object graphs need in
+        // practice; shallow chains come out first and are the stable ones.
+        constexpr size_t kMaxChainDepth = 5;
+        constexpr uintptr_t kMaxHopOffset = 0x800;
+        constexpr size_t kMaxChains = 32;
+
+        const auto snapshot = takeFullSnapshot();
+        if (!snapshot) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Chain search could not snapshot the target");
+            return;
+        }
+
+        PointerMap map;
+        map.build(*snapshot, modules);
+        std::vector<PointerChain> chains = map.findChains(target, kMaxChainDepth, kMaxHopOffset, kMaxChains);
+        util::Logger::instance().log(util::Logger::Level::Info,
+            "Chain search found " + std::to_string(chains.size()) + " module-rooted chains");
+        m_chainResultCount.store(chains.size());
+
+        std::lock_guard<std::mutex> lock(m_resultsMutex);
+        m_chainResults = std::move(chains);
     });
+}
+
+std::vector<PointerChain> MemoryScanner::chainResults() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_chainResults;
+}
+
+size_t MemoryScanner::readRegionBytes(const MemoryRegion& region, uint8_t* dest) const {
+    SIZE_T bytesRead = 0;
+    if (ReadProcessMemory(m_process, reinterpret_cast<LPCVOID>(region.base), dest, region.size, &bytesRead)) {
+        return bytesRead;
+    }
+
+    // A region can lose pages between VirtualQueryEx and the read; retry
+    // page-by-page and keep the readable prefix rather than dropping the scan.
+    const size_t pageSize = 4096;
+    size_t captured = 0;
+    while (captured < region.size) {
+        const size_t chunk = std::min(pageSize, region.size - captured);
+        if (!ReadProcessMemory(m_process, reinterpret_cast<LPCVOID>(region.base + captured), dest + captured, chunk, &bytesRead)) {
+            break;
+        }
+        captured += bytesRead;
+    }
+    return captured;
+}
 
-    if (it == m_freezeEntries.end()) {
-        FreezeEntry entry;
-        entry.address = address;
-        entry.value.assign(reinterpret_cast<const uint8_t*>(buffer), reinterpret_cast<const uint8_t*>(buffer) + size);
-        entry.active = true;
-        m_freezeEntries.push_back(std::move(entry));
+std::optional<ByteSignature> parseSignature(const std::string& text) {
+    ByteSignature signature;
+    size_t i = 0;
+    while (i < text.size()) {
+        if (text[i] == ' ') {
+            ++i;
+            continue;
+        }
+        size_t tokenEnd = i;
+        while (tokenEnd < text.size() && text[tokenEnd] != ' ') {
+            ++tokenEnd;
+        }
+        const size_t tokenSize = tokenEnd - i;
+        if (text[i] == '?') {
+            if (tokenSize > 2 || (tokenSize == 2 && text[i + 1] != '?')) {
+                return std::nullopt;
+            }
+            signature.bytes.push_back(0);
+            signature.mask.push_back(0);
+        } else {
+            if (tokenSize != 2 || !std::isxdigit(static_cast<unsigned char>(text[i])) ||
+                !std::isxdigit(static_cast<unsigned char>(text[i + 1]))) {
+                return std::nullopt;
+            }
+            signature.bytes.push_back(static_cast<uint8_t>(std::stoul(text.substr(i, 2), nullptr, 16)));
+            signature.mask.push_back(1);
+        }
+        i = tokenEnd;
+    }
+
+    if (!chooseAnchor(signature)) {
+        return std::nullopt;
+    }
+    return signature;
+}
+
+ByteSignature makeStringSignature(const std::string& text, StringEncoding encoding) {
+    ByteSignature signature;
+    if (text.empty()) {
+        return signature;
+    }
+
+    if (encoding == StringEncoding::Utf16) {
+        const std::wstring wide = util::utf8ToWide(text);
+        const uint8_t* raw = reinterpret_cast<const uint8_t*>(wide.data());
+        signature.bytes.assign(raw, raw + wide.size() * sizeof(wchar_t));
     } else {
-        it->value.assign(reinterpret_cast<const uint8_t*>(buffer), reinterpret_cast<const uint8_t*>(buffer) + size);
-        it->active = true;
+        signature.bytes.assign(text.begin(), text.end());
+    }
+    signature.mask.assign(signature.bytes.size(), 1);
+
+    if (!chooseAnchor(signature)) {
+        signature.bytes.clear();
+        signature.mask.clear();
     }
+    return signature;
+}
 
-    if (!m_freezeRequested.load()) {
-        m_freezeRequested = true;
-        m_freezeThread = std::thread(&MemoryScanner::freezeLoop, this);
+size_t scanValueSize(ScanValueType type) {
+    switch (type) {
+    case ScanValueType::Int8:   return 1;
+    case ScanValueType::Int16:  return 2;
+    case ScanValueType::Int32:  return 4;
+    case ScanValueType::Int64:  return 8;
+    case ScanValueType::Float:  return 4;
+    case ScanValueType::Double: return 8;
     }
+    return 4;
 }
 
-void MemoryScanner::clearFreezes() {
-    {
-        std::lock_guard<std::mutex> lock(m_freezeMutex);
-        m_freezeEntries.clear();
+bool MemoryScanner::beginUnknownScan(ScanValueType valueType) {
+    endScan();
+    if (!m_process) {
+        return false;
     }
+    ScopedPerfTimer passTimer(PerfMonitor::Section::ScanPass);
+    m_session.valueType = valueType;
+    m_session.candidates.setSlotBytes(scanValueSize(valueType));
 
-    m_freezeRequested = false;
-    if (m_freezeThread.joinable()) {
-        m_freezeThread.join();
+    std::vector<MemoryRegion> regions = queryWritableRegions();
+    if (regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Unknown-value scan found no writable private regions");
+        return false;
     }
+
+    size_t totalBytes = 0;
+    for (const auto& region : regions) {
+        totalBytes += region.size;
+    }
+
+    if (!m_session.baseline.create(totalBytes)) {
+        return false;
+    }
+
+    size_t writeOffset = 0;
+    size_t visitedBytes = 0;
+    for (const auto& region : regions) {
+        if (m_scanCancel.load()) {
+            util::Logger::instance().log(util::Logger::Level::Info, "Unknown-value baseline capture cancelled");
+            endScan();
+            return false;
+        }
+
+        const size_t captured = readRegionBytes(region, m_session.baseline.data() + writeOffset);
+        PerfMonitor::instance().add(PerfMonitor::Counter::ScanBytes, captured);
+        visitedBytes += region.size;
+        m_scanProgress.store(static_cast<float>(visitedBytes) / static_cast<float>(totalBytes));
+        if (captured == 0) {
+            continue;
+        }
+        m_session.regions.push_back(MemoryRegion{ region.base, captured });
+        m_session.regionOffsets.push_back(writeOffset);
+        m_session.regionPageHashes.push_back(hashRegionPages(m_session.baseline.data() + writeOffset, captured));
+        m_session.candidates.addRegion(region.base, captured);
+        writeOffset += captured;
+    }
+
+    if (m_session.regions.empty()) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Unknown-value scan failed: no region could be read");
+        endScan();
+        return false;
+    }
+
+    m_session.candidates.fillAll();
+    m_session.active = true;
+    publishScanResults();
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Unknown-value baseline captured: " + std::to_string(m_session.regions.size()) + " regions, "
+        + std::to_string(writeOffset / (1024 * 1024)) + " MiB spilled to temp mapping");
+    return true;
 }
 
-void MemoryScanner::freezeLoop() {
-    util::Logger::instance().log(util::Logger::Level::Info, "Freeze loop started");
+void MemoryScanner::refineScan(ScanRefineMode mode) {
+    if (!m_session.active) {
+        return;
+    }
 
-    while (m_freezeRequested.load()) {
+    // One runtime dispatch on the session's value type and refinement mode;
+    // everything below runs in a loop specialized for both.
+    switch (m_session.valueType) {
+    case ScanValueType::Int8:   refineDispatch<int8_t>(mode); break;
+    case ScanValueType::Int16:  refineDispatch<int16_t>(mode); break;
+    case ScanValueType::Int32:  refineDispatch<int32_t>(mode); break;
+    case ScanValueType::Int64:  refineDispatch<int64_t>(mode); break;
+    case ScanValueType::Float:  refineDispatch<float>(mode); break;
+    case ScanValueType::Double: refineDispatch<double>(mode); break;
+    }
+}
+
+template <typename T>
+void MemoryScanner::refineDispatch(ScanRefineMode mode) {
+    switch (mode) {
+    case ScanRefineMode::Increased:
+        refinePass<T>([](T previous, T current) { return current > previous; }, false);
+        break;
+    case ScanRefineMode::Decreased:
+        refinePass<T>([](T previous, T current) { return current < previous; }, false);
+        break;
+    case ScanRefineMode::Changed:
+        refinePass<T>([](T previous, T current) { return current != previous; }, false);
+        break;
+    case ScanRefineMode::Unchanged:
+        refinePass<T>([](T previous, T current) { return current == previous; }, true);
+        break;
+    }
+}
+
+template <typename T, typename Keeps>
+void MemoryScanner::refinePass(Keeps keeps, bool keepsOnCleanPage) {
+    ScopedPerfTimer passTimer(PerfMonitor::Section::ScanPass);
+    // Stream the target in fixed chunks; the chunk size is a multiple of 64
+    // slots of every supported width, so a chunk always covers whole bitmap words.
+    constexpr size_t kChunkBytes = 4u * 1024 * 1024;
+    constexpr size_t kSlotBytes = sizeof(T);
+
+    // Flatten the pass into a chunk job list so a reader stage can run one
+    // chunk ahead of the compare stage. ReadProcessMemory mostly waits on the
+    // kernel while the compare burns CPU and memory bandwidth, so overlapping
+    // the two hides whichever phase is cheaper behind the other.
+    struct ChunkJob {
+        size_t regionIndex = 0;
+        size_t chunkOffset = 0;
+        size_t chunkSize = 0;
+    };
+    std::vector<ChunkJob> jobs;
+    std::vector<uint64_t*> regionWordPtrs(m_session.regions.size(), nullptr);
+    std::vector<size_t> regionSlotCounts(m_session.regions.size(), 0);
+    size_t totalBytes = 0;
+    for (size_t regionIndex = 0; regionIndex < m_session.regions.size(); ++regionIndex) {
+        const MemoryRegion& region = m_session.regions[regionIndex];
+        totalBytes += region.size;
+        regionWordPtrs[regionIndex] = m_session.candidates.regionWords(region.base, &regionSlotCounts[regionIndex]);
+        if (!regionWordPtrs[regionIndex]) {
+            continue;
+        }
+        for (size_t chunkOffset = 0; chunkOffset < region.size; chunkOffset += kChunkBytes) {
+            jobs.push_back(ChunkJob{ regionIndex, chunkOffset, std::min(kChunkBytes, region.size - chunkOffset) });
+        }
+    }
+
+    // Per-chunk word span inside its region's bitmap. Adjacent chunks never
+    // share words (the chunk size covers whole words at every slot width), so
+    // reader and compare stages touch disjoint bitmap state.
+    const auto chunkWordSpan = [&](const ChunkJob& job, size_t& firstWord, size_t& lastWord) {
+        const size_t firstSlot = job.chunkOffset / kSlotBytes;
+        const size_t lastSlot = std::min(regionSlotCounts[job.regionIndex], (job.chunkOffset + job.chunkSize) / kSlotBytes);
+        firstWord = firstSlot / 64;
+        lastWord = (lastSlot + 63) / 64;
+    };
+
+    // Double buffer: job i lands in buffer i % 2, cycling
+    // Free -> (reader) -> Ready/Skipped/Failed -> (compare) -> Free.
+    enum class SlotState { Free, Ready, Skipped, Failed };
+    struct ChunkSlot {
+        uint8_t* data = nullptr;
+        SlotState state = SlotState::Free;
+    };
+    // The double buffers come out of the scan arena: the first pass pays for
+    // them once and later passes recycle the same blocks.
+    m_scanArena.reset();
+    ChunkSlot slots[2];
+    slots[0].data = static_cast<uint8_t*>(m_scanArena.allocate(kChunkBytes, alignof(uint64_t)));
+    slots[1].data = static_cast<uint8_t*>(m_scanArena.allocate(kChunkBytes, alignof(uint64_t)));
+    std::mutex pipeMutex;
+    std::condition_variable pipeCv;
+
+    std::thread reader([&]() {
+        for (size_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex) {
+            ChunkSlot& slot = slots[jobIndex % 2];
+            {
+                std::unique_lock<std::mutex> lock(pipeMutex);
+                pipeCv.wait(lock, [&]() { return slot.state == SlotState::Free || m_scanCancel.load(); });
+            }
+            if (m_scanCancel.load()) {
+                return;
+            }
+
+            const ChunkJob& job = jobs[jobIndex];
+            const uint64_t* words = regionWordPtrs[job.regionIndex];
+            size_t firstWord = 0;
+            size_t lastWord = 0;
+            chunkWordSpan(job, firstWord, lastWord);
+
+            // Skip the read entirely when no candidate survives in this chunk.
+            // The compare stage only ever clears bits, so a stale sighting here
+            // costs at most one redundant read.
+            bool hasCandidates = false;
+            for (size_t w = firstWord; w < lastWord && !hasCandidates; ++w) {
+                hasCandidates = words[w] != 0;
+            }
+
+            SlotState produced = SlotState::Skipped;
+            if (hasCandidates) {
+                const uintptr_t chunkBase = m_session.regions[job.regionIndex].base + job.chunkOffset;
+                produced = read(chunkBase, slot.data, job.chunkSize) ? SlotState::Ready : SlotState::Failed;
+            }
+            {
+                std::lock_guard<std::mutex> lock(pipeMutex);
+                slot.state = produced;
+            }
+            pipeCv.notify_all();
+        }
+    });
+
+    size_t processedBytes = 0;
+    bool cancelled = false;
+    for (size_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex) {
+        ChunkSlot& slot = slots[jobIndex % 2];
+        SlotState state = SlotState::Free;
         {
-            std::lock_guard<std::mutex> lock(m_freezeMutex);
-            for (auto& entry : m_freezeEntries) {
-                if (!entry.active) {
+            std::unique_lock<std::mutex> lock(pipeMutex);
+            pipeCv.wait(lock, [&]() { return slot.state != SlotState::Free || m_scanCancel.load(); });
+            state = slot.state;
+        }
+        if (m_scanCancel.load()) {
+            cancelled = true;
+            break;
+        }
+
+        const ChunkJob& job = jobs[jobIndex];
+        const size_t chunkOffset = job.chunkOffset;
+        const size_t chunkSize = job.chunkSize;
+        uint64_t* words = regionWordPtrs[job.regionIndex];
+        uint8_t* baseline = m_session.baseline.data() + m_session.regionOffsets[job.regionIndex];
+        size_t firstWord = 0;
+        size_t lastWord = 0;
+        chunkWordSpan(job, firstWord, lastWord);
+
+        processedBytes += chunkSize;
+        PerfMonitor::instance().add(PerfMonitor::Counter::ScanBytes, chunkSize);
+        m_scanProgress.store(static_cast<float>(processedBytes) / static_cast<float>(totalBytes));
+
+        if (state == SlotState::Failed) {
+            // Region shrank or was decommitted; drop every candidate it held.
+            for (size_t w = firstWord; w < lastWord; ++w) {
+                words[w] = 0;
+            }
+        } else if (state == SlotState::Ready) {
+            // Pages cover a whole number of bitmap words at every slot width,
+            // so the hash fast path can act on whole words.
+            std::vector<uint64_t>& pageHashes = m_session.regionPageHashes[job.regionIndex];
+            for (size_t pageOffset = 0; pageOffset < chunkSize; pageOffset += kHashPageBytes) {
+                const size_t pageBytes = std::min(kHashPageBytes, chunkSize - pageOffset);
+                const size_t pageIndex = (chunkOffset + pageOffset) / kHashPageBytes;
+                const size_t pageFirstWord = (chunkOffset + pageOffset) / kSlotBytes / 64;
+                const size_t pageLastWord = std::min(lastWord, pageFirstWord + kHashPageBytes / kSlotBytes / 64);
+
+                const uint64_t freshHash = hashPage(slot.data + pageOffset, pageBytes);
+                if (freshHash == pageHashes[pageIndex]) {
+                    // Nothing on this page moved since the last capture: its candidates
+                    // fail increased/decreased/changed wholesale and pass unchanged,
+                    // with no per-slot compare or baseline update needed.
+                    if (!keepsOnCleanPage) {
+                        for (size_t w = pageFirstWord; w < pageLastWord; ++w) {
+                            words[w] = 0;
+                        }
+                    }
                     continue;
                 }
-                if (!write(entry.address, entry.value.data(), entry.value.size())) {
-                    util::Logger::instance().log(util::Logger::Level::Warning, "Failed to maintain frozen value");
+                pageHashes[pageIndex] = freshHash;
+
+                for (size_t w = pageFirstWord; w < pageLastWord; ++w) {
+                    uint64_t word = words[w];
+                    while (word != 0) {
+                        uint64_t lowest = word & (~word + 1);
+                        size_t bit = 0;
+                        for (uint64_t probe = lowest >> 1; probe != 0; probe >>= 1) {
+                            ++bit;
+                        }
+                        word &= word - 1;
+
+                        const size_t slot2 = w * 64 + bit;
+                        const size_t byteOffset = slot2 * kSlotBytes;
+                        T previousValue{};
+                        T currentValue{};
+                        std::memcpy(&previousValue, baseline + byteOffset, sizeof(previousValue));
+                        std::memcpy(&currentValue, slot.data + (byteOffset - chunkOffset), sizeof(currentValue));
+
+                        if (keeps(previousValue, currentValue)) {
+                            // Next refinement compares against this pass, not the original baseline.
+                            std::memcpy(baseline + byteOffset, &currentValue, sizeof(currentValue));
+                        } else {
+                            words[w] &= ~(uint64_t(1) << bit);
+                        }
+                    }
                 }
             }
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        {
+            std::lock_guard<std::mutex> lock(pipeMutex);
+            slot.state = SlotState::Free;
+        }
+        pipeCv.notify_all();
+    }
+
+    pipeCv.notify_all();
+    reader.join();
+
+    if (cancelled) {
+        util::Logger::instance().log(util::Logger::Level::Info, "Refinement pass cancelled");
+        publishScanResults();
+        return;
+    }
+
+    publishScanResults();
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Refinement pass kept " + std::to_string(m_candidateCount.load()) + " candidates");
+}
+
+bool MemoryScanner::startScanJob(std::function<void()> job) {
+    if (m_scanActive.load()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Scan already in progress");
+        return false;
+    }
+    if (m_scanThread.joinable()) {
+        m_scanThread.join();
+    }
+
+    m_scanCancel = false;
+    m_scanProgress = 0.0f;
+    m_scanActive = true;
+    m_scanThread = std::thread([this, job = std::move(job)]() {
+        job();
+        m_scanProgress = 1.0f;
+        m_scanActive = false;
+    });
+    return true;
+}
+
+bool MemoryScanner::startUnknownScanAsync(ScanValueType valueType) {
+    return startScanJob([this, valueType]() { beginUnknownScan(valueType); });
+}
+
+bool MemoryScanner::startRefineAsync(ScanRefineMode mode) {
+    if (!m_session.active) {
+        return false;
+    }
+    return startScanJob([this, mode]() { refineScan(mode); });
+}
+
+void MemoryScanner::publishScanResults() {
+    // Counting the bitmap is O(words); do it once per pass here instead of every
+    // GUI frame, and cache the lowest addresses for the results list.
+    constexpr size_t kMaxTopCandidates = 128;
+    m_candidateCount.store(m_session.candidates.count());
+
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    m_topCandidates = m_session.candidates.toAddresses(kMaxTopCandidates);
+}
+
+std::vector<uintptr_t> MemoryScanner::topCandidates() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_topCandidates;
+}
+
+void MemoryScanner::endScan() {
+    m_session.regions.clear();
+    m_session.regionOffsets.clear();
+    m_session.regionPageHashes.clear();
+    m_session.baseline.reset();
+    m_session.sourcePath.clear();
+    m_session.candidates.clear();
+    m_session.active = false;
+    m_scanArena.release();
+    m_candidateCount.store(0);
+
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    m_topCandidates.clear();
+}
+
+bool MemoryScanner::saveScanSession(const std::filesystem::path& path) {
+    if (!m_session.active) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "No active scan session to save");
+        return false;
+    }
+    if (m_scanActive.load()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Cannot save while a scan pass is in flight");
+        return false;
+    }
+
+    const size_t slotBytes = scanValueSize(m_session.valueType);
+
+    // A resumed session's baseline IS the session file, held open by the
+    // mapping — an ofstream on the same path would hit a sharing violation.
+    // The baseline bytes are already current through the view, so refresh the
+    // page-hash and bitmap sections in place and flush.
+    if (!m_session.sourcePath.empty() && path == m_session.sourcePath) {
+        uint8_t* cursor = m_session.baseline.data() + sizeof(SessionFileHeader) +
+                          m_session.regions.size() * sizeof(SessionFileRegion);
+        for (const auto& pageHashes : m_session.regionPageHashes) {
+            std::memcpy(cursor, pageHashes.data(), pageHashes.size() * sizeof(uint64_t));
+            cursor += pageHashes.size() * sizeof(uint64_t);
+        }
+        for (const auto& region : m_session.regions) {
+            const uint64_t* words = m_session.candidates.regionWords(region.base);
+            std::memcpy(cursor, words, sessionWordCount(region.size, slotBytes) * sizeof(uint64_t));
+            cursor += sessionWordCount(region.size, slotBytes) * sizeof(uint64_t);
+        }
+        if (!m_session.baseline.flush()) {
+            util::Logger::instance().log(util::Logger::Level::Error, "Scan session flush failed");
+            return false;
+        }
+        util::Logger::instance().log(util::Logger::Level::Info, "Scan session updated in place");
+        return true;
+    }
+
+    SessionFileHeader header;
+    header.magic = kSessionMagic;
+    header.version = kSessionVersion;
+    header.valueType = static_cast<uint32_t>(m_session.valueType);
+    header.regionCount = m_session.regions.size();
+
+    size_t tableBytes = sizeof(SessionFileHeader) + m_session.regions.size() * sizeof(SessionFileRegion);
+    size_t dataBytes = 0;
+    for (const auto& region : m_session.regions) {
+        tableBytes += (sessionPageCount(region.size) + sessionWordCount(region.size, slotBytes)) * sizeof(uint64_t);
+        dataBytes += region.size;
+    }
+    header.dataOffset = (tableBytes + kSessionDataAlign - 1) / kSessionDataAlign * kSessionDataAlign;
+    header.dataBytes = dataBytes;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Unable to create scan session file");
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& region : m_session.regions) {
+        SessionFileRegion fileRegion{ region.base, region.size };
+        file.write(reinterpret_cast<const char*>(&fileRegion), sizeof(fileRegion));
+    }
+    for (const auto& pageHashes : m_session.regionPageHashes) {
+        file.write(reinterpret_cast<const char*>(pageHashes.data()), pageHashes.size() * sizeof(uint64_t));
+    }
+    for (const auto& region : m_session.regions) {
+        size_t slotCount = 0;
+        const uint64_t* words = m_session.candidates.regionWords(region.base, &slotCount);
+        file.write(reinterpret_cast<const char*>(words), sessionWordCount(region.size, slotBytes) * sizeof(uint64_t));
     }
 
-    util::Logger::instance().log(util::Logger::Level::Info, "Freeze loop exited");
+    const std::vector<char> padding(header.dataOffset - tableBytes, 0);
+    file.write(padding.data(), padding.size());
+
+    // Region bytes are packed back to back in the baseline, starting at the
+    // first region's offset (zero for a fresh capture, past the header for a
+    // resumed file), so the payload stays one contiguous sequential write.
+    for (size_t i = 0; i < m_session.regions.size(); ++i) {
+        file.write(reinterpret_cast<const char*>(m_session.baseline.data() + m_session.regionOffsets[i]),
+                   m_session.regions[i].size);
+    }
+
+    if (!file.good()) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Scan session write failed");
+        return false;
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Scan session saved: " + std::to_string((header.dataOffset + dataBytes) / (1024 * 1024)) + " MiB");
+    return true;
+}
+
+bool MemoryScanner::loadScanSession(const std::filesystem::path& path) {
+    if (m_scanActive.load()) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Cannot load while a scan pass is in flight");
+        return false;
+    }
+    endScan();
+
+    MappedFileBuffer mapped;
+    if (!mapped.openExisting(path.c_str())) {
+        return false;
+    }
+
+    SessionFileHeader header;
+    if (mapped.size() < sizeof(header)) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Scan session file truncated");
+        return false;
+    }
+    std::memcpy(&header, mapped.data(), sizeof(header));
+    // Header fields come straight off disk: every bound below is written as a
+    // subtract-and-compare so a corrupt value fails the check instead of
+    // wrapping past it.
+    if (header.magic != kSessionMagic || header.version != kSessionVersion ||
+        header.valueType > static_cast<uint32_t>(ScanValueType::Double) ||
+        header.dataOffset < sizeof(header) || header.dataOffset > mapped.size() ||
+        header.dataBytes > mapped.size() - header.dataOffset) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Scan session file invalid or from another version");
+        return false;
+    }
+
+    m_session.valueType = static_cast<ScanValueType>(header.valueType);
+    const size_t slotBytes = scanValueSize(m_session.valueType);
+    m_session.candidates.setSlotBytes(slotBytes);
+
+    // Validate the derived layout before trusting any section pointer. The
+    // region count is bounded before it multiplies anything, so the table size
+    // cannot wrap small and admit a count larger than the mapping.
+    if (header.regionCount > (header.dataOffset - sizeof(SessionFileHeader)) / sizeof(SessionFileRegion)) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Scan session region table overruns data section");
+        return false;
+    }
+    size_t tableBytes = sizeof(SessionFileHeader) + static_cast<size_t>(header.regionCount) * sizeof(SessionFileRegion);
+    const SessionFileRegion* fileRegions = reinterpret_cast<const SessionFileRegion*>(mapped.data() + sizeof(header));
+    size_t dataBytes = 0;
+    for (uint64_t i = 0; i < header.regionCount; ++i) {
+        // Bound each region size before deriving counts from it; both running
+        // sums grow through the same subtract-and-compare form as above.
+        if (fileRegions[i].size > header.dataBytes - dataBytes) {
+            util::Logger::instance().log(util::Logger::Level::Error, "Scan session layout mismatch");
+            return false;
+        }
+        const size_t regionSize = static_cast<size_t>(fileRegions[i].size);
+        const size_t sectionWords = sessionPageCount(regionSize) + sessionWordCount(regionSize, slotBytes);
+        if (sectionWords > (header.dataOffset - tableBytes) / sizeof(uint64_t)) {
+            util::Logger::instance().log(util::Logger::Level::Error, "Scan session region table overruns data section");
+            return false;
+        }
+        tableBytes += sectionWords * sizeof(uint64_t);
+        dataBytes += regionSize;
+    }
+    if (dataBytes != header.dataBytes) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Scan session layout mismatch");
+        return false;
+    }
+
+    // The mapped file itself becomes the session baseline: region offsets
+    // simply point past the header into the data section.
+    size_t dataCursor = header.dataOffset;
+    for (uint64_t i = 0; i < header.regionCount; ++i) {
+        m_session.regions.push_back(MemoryRegion{ static_cast<uintptr_t>(fileRegions[i].base), static_cast<size_t>(fileRegions[i].size) });
+        m_session.regionOffsets.push_back(dataCursor);
+        m_session.candidates.addRegion(static_cast<uintptr_t>(fileRegions[i].base), static_cast<size_t>(fileRegions[i].size));
+        dataCursor += fileRegions[i].size;
+    }
+
+    const uint8_t* cursor = mapped.data() + sizeof(header) + header.regionCount * sizeof(SessionFileRegion);
+    for (const auto& region : m_session.regions) {
+        const size_t pageCount = sessionPageCount(region.size);
+        std::vector<uint64_t> pageHashes(pageCount);
+        std::memcpy(pageHashes.data(), cursor, pageCount * sizeof(uint64_t));
+        m_session.regionPageHashes.push_back(std::move(pageHashes));
+        cursor += pageCount * sizeof(uint64_t);
+    }
+    for (const auto& region : m_session.regions) {
+        uint64_t* words = m_session.candidates.regionWords(region.base);
+        const size_t wordCount = sessionWordCount(region.size, slotBytes);
+        std::memcpy(words, cursor, wordCount * sizeof(uint64_t));
+        cursor += wordCount * sizeof(uint64_t);
+    }
+
+    m_session.baseline = std::move(mapped);
+    m_session.sourcePath = path;
+    m_session.active = true;
+    publishScanResults();
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Scan session resumed: " + std::to_string(m_session.regions.size()) + " regions, " +
+        std::to_string(m_candidateCount.load()) + " candidates");
+    return true;
+}
+
+CandidateSet MemoryScanner::compareSnapshots(const MemorySnapshot& previous, const MemorySnapshot& current, int expectedDelta) {
+    const size_t count = std::min(previous.data.size(), current.data.size());
+    const size_t valueCount = count / sizeof(int);
+
+    // 1 Mi values (4 MiB) per chunk keeps per-chunk overhead negligible while
+    // giving the pool enough chunks to steal when sizes are uneven.
+    constexpr size_t kValuesPerChunk = 1u << 20;
+    const size_t chunkCount = (valueCount + kValuesPerChunk - 1) / kValuesPerChunk;
+
+    // Plain vectors: the kernels take std::vector<uintptr_t>&, and matches are
+    // sparse, so this is one short-lived allocation per chunk, not per element.
+    std::vector<std::vector<uintptr_t>> chunkResults(chunkCount);
+    WorkerPool::instance().parallelFor(chunkCount, [&](size_t chunk) {
+        const size_t firstValue = chunk * kValuesPerChunk;
+        const size_t lastValue = std::min(firstValue + kValuesPerChunk, valueCount);
+        const size_t byteOffset = firstValue * sizeof(int);
+        scan::deltaCompareI32(previous.data.data() + byteOffset, current.data.data() + byteOffset,
+                              lastValue - firstValue, expectedDelta,
+                              previous.base + byteOffset, chunkResults[chunk]);
+    });
+
+    // Merge per-chunk matches into the compact bitmap; cost is proportional to
+    // the number of matches, not the snapshot size.
+    CandidateSet results;
+    results.addRegion(previous.base, count);
+    size_t total = 0;
+    for (const auto& local : chunkResults) {
+        for (uintptr_t address : local) {
+            results.add(address);
+        }
+        total += local.size();
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info, "compareSnapshots narrowed to " + std::to_string(total) + " candidates");
+    return results;
+}
+
+template <typename T>
+void MemoryScanner::filterCandidates(CandidateSet& candidates, T expectedValue) {
+    // Exact match is the degenerate interval; for floats [v, v] and == agree
+    // exactly (NaN matches neither), so one core serves both paths.
+    filterCandidatesRange(candidates, expectedValue, expectedValue);
+}
+
+template <typename T>
+void MemoryScanner::filterCandidatesRange(CandidateSet& candidates, T low, T high) {
+    constexpr size_t kMaxGapBytes = 4096;       // bridge gaps up to a page inside one read
+    constexpr size_t kMaxRunBytes = 256 * 1024; // cap the span of a single syscall
+    constexpr size_t kBatchSize = 1u << 16;     // addresses gathered before a flush
+
+    size_t kept = 0;
+    std::vector<uint8_t> buffer;
+    std::vector<uintptr_t> pending;
+    std::vector<uintptr_t> kernelMatches;
+    pending.reserve(kBatchSize);
+
+    // Bitmap iteration already yields addresses sorted, so runs coalesce directly.
+    auto flush = [&]() {
+        size_t runBegin = 0;
+        while (runBegin < pending.size()) {
+            size_t runEnd = runBegin + 1;
+            while (runEnd < pending.size()) {
+                const size_t gap = pending[runEnd] - pending[runEnd - 1];
+                const size_t span = pending[runEnd] + sizeof(T) - pending[runBegin];
+                if (gap > kMaxGapBytes || span > kMaxRunBytes) {
+                    break;
+                }
+                ++runEnd;
+            }
+
+            const uintptr_t runBase = pending[runBegin];
+            const size_t runCount = runEnd - runBegin;
+            const size_t runSpan = pending[runEnd - 1] + sizeof(T) - runBase;
+            buffer.resize(runSpan);
+
+            if (read(runBase, buffer.data(), runSpan)) {
+                bool handled = false;
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+                    // Dense runs (every slot a candidate, common right after a
+                    // first scan) go through the vectorized range kernel; both
+                    // lists are ascending, so a lockstep walk applies the result.
+                    if (runSpan == runCount * sizeof(T)) {
+                        kernelMatches.clear();
+                        if constexpr (std::is_same_v<T, float>) {
+                            scan::rangeCompareF32(buffer.data(), runCount, low, high, runBase, kernelMatches);
+                        } else {
+                            scan::rangeCompareF64(buffer.data(), runCount, low, high, runBase, kernelMatches);
+                        }
+                        size_t matchIndex = 0;
+                        for (size_t i = runBegin; i < runEnd; ++i) {
+                            if (matchIndex < kernelMatches.size() && kernelMatches[matchIndex] == pending[i]) {
+                                ++matchIndex;
+                                ++kept;
+                            } else {
+                                candidates.remove(pending[i]);
+                            }
+                        }
+                        handled = true;
+                    }
+                }
+                if (!handled) {
+                    for (size_t i = runBegin; i < runEnd; ++i) {
+                        T value{};
+                        std::memcpy(&value, buffer.data() + (pending[i] - runBase), sizeof(value));
+                        if (value >= low && value <= high) {
+                            ++kept;
+                        } else {
+                            candidates.remove(pending[i]);
+                        }
+                    }
+                }
+            } else {
+                // A page inside the run may have been decommitted; re-check each
+                // candidate individually so one bad page doesn't drop its neighbours.
+                for (size_t i = runBegin; i < runEnd; ++i) {
+                    T value{};
+                    if (read(pending[i], &value, sizeof(value)) && value >= low && value <= high) {
+                        ++kept;
+                    } else {
+                        candidates.remove(pending[i]);
+                    }
+                }
+            }
+
+            runBegin = runEnd;
+        }
+        pending.clear();
+    };
+
+    candidates.forEach([&](uintptr_t address) {
+        pending.push_back(address);
+        if (pending.size() >= kBatchSize) {
+            flush();
+        }
+    });
+    flush();
+
+    util::Logger::instance().log(util::Logger::Level::Info, "filterCandidates resulted in " + std::to_string(kept) + " matches");
+}
+
+template <typename T>
+void MemoryScanner::filterClampedRange(double low, double high) {
+    if constexpr (std::is_integral_v<T>) {
+        low = std::ceil(low);
+        high = std::floor(high);
+    }
+
+    // Casting a double beyond T's range is undefined, so the bounds saturate
+    // to the type's limits first. An interval that misses the range entirely
+    // (or carries a NaN bound) inverts instead; an inverted interval keeps
+    // nothing, which is the right answer for a bound no slot can reach.
+    const double typeMin = static_cast<double>(std::numeric_limits<T>::lowest());
+    const double typeMax = static_cast<double>(std::numeric_limits<T>::max());
+    if (std::isnan(low) || std::isnan(high) || low > typeMax || high < typeMin) {
+        filterCandidatesRange<T>(m_session.candidates, std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest());
+        return;
+    }
+
+    const auto clampToType = [&](double value) {
+        if (value <= typeMin) {
+            return std::numeric_limits<T>::lowest();
+        }
+        if (value >= typeMax) {
+            return std::numeric_limits<T>::max();
+        }
+        return static_cast<T>(value);
+    };
+    filterCandidatesRange<T>(m_session.candidates, clampToType(low), clampToType(high));
+}
+
+bool MemoryScanner::startValueFilterAsync(double low, double high) {
+    if (!m_session.active) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "No active scan session to filter");
+        return false;
+    }
+    return startScanJob([this, low, high]() {
+        ScopedPerfTimer passTimer(PerfMonitor::Section::ScanPass);
+        switch (m_session.valueType) {
+        case ScanValueType::Int8:
+            filterClampedRange<int8_t>(low, high);
+            break;
+        case ScanValueType::Int16:
+            filterClampedRange<int16_t>(low, high);
+            break;
+        case ScanValueType::Int32:
+            filterClampedRange<int32_t>(low, high);
+            break;
+        case ScanValueType::Int64:
+            filterClampedRange<int64_t>(low, high);
+            break;
+        case ScanValueType::Float:
+            filterClampedRange<float>(low, high);
+            break;
+        case ScanValueType::Double:
+            filterClampedRange<double>(low, high);
+            break;
+        }
+        publishScanResults();
+    });
 }
 
+// The supported scan value types; keeps the specialized loops out of the header.
+template void MemoryScanner::filterCandidates<int8_t>(CandidateSet&, int8_t);
+template void MemoryScanner::filterCandidates<int16_t>(CandidateSet&, int16_t);
+template void MemoryScanner::filterCandidates<int32_t>(CandidateSet&, int32_t);
+template void MemoryScanner::filterCandidates<int64_t>(CandidateSet&, int64_t);
+template void MemoryScanner::filterCandidates<float>(CandidateSet&, float);
+template void MemoryScanner::filterCandidates<double>(CandidateSet&, double);
+template void MemoryScanner::filterCandidatesRange<int8_t>(CandidateSet&, int8_t, int8_t);
+template void MemoryScanner::filterCandidatesRange<int16_t>(CandidateSet&, int16_t, int16_t);
+template void MemoryScanner::filterCandidatesRange<int32_t>(CandidateSet&, int32_t, int32_t);
+template void MemoryScanner::filterCandidatesRange<int64_t>(CandidateSet&, int64_t, int64_t);
+template void MemoryScanner::filterCandidatesRange<float>(CandidateSet&, float, float);
+template void MemoryScanner::filterCandidatesRange<double>(CandidateSet&, double, double);
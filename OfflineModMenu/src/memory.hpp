@@ -1,26 +1,99 @@
 #pragma once
 
+#include "arena.hpp"
+#include "candidate_set.hpp"
+#include "mapped_buffer.hpp"
+
 #include <windows.h>
 
 #include <cstdint>
 #include <vector>
 #include <atomic>
+#include <filesystem>
+#include <functional>
 #include <thread>
 #include <mutex>
 #include <optional>
+#include <string>
+
+struct ModuleRegion;
+struct PointerChain;
 
 struct MemorySnapshot {
     uintptr_t base = 0;
     std::vector<uint8_t> data;
 };
 
-//! Helper struct representing a frozen memory address.
-struct FreezeEntry {
-    uintptr_t address = 0;
-    std::vector<uint8_t> value;
-    bool active = false;
+//! One committed, writable region discovered by walking the target's address space.
+struct MemoryRegion {
+    uintptr_t base = 0;
+    size_t size = 0;
+};
+
+//! Snapshot of every writable private region in the target, captured in one pass.
+//! Region contents are concatenated into `data`; `regionOffsets[i]` is the byte
+//! offset of `regions[i]` within it. Regions are sorted ascending by base.
+struct FullSnapshot {
+    std::vector<MemoryRegion> regions;
+    std::vector<size_t> regionOffsets;
+    std::vector<uint8_t> data;
+
+    size_t totalBytes() const { return data.size(); }
+
+    //! Translates an absolute target address into an offset in `data`, if captured.
+    std::optional<size_t> offsetOf(uintptr_t address) const;
+};
+
+//! Refinement predicates for unknown-initial-value scan sessions.
+enum class ScanRefineMode {
+    Increased,
+    Decreased,
+    Changed,
+    Unchanged
+};
+
+//! Value interpretations supported by the scan engine. The runtime switch on
+//! this type happens once per pass at the API boundary; the inner loops are
+//! templates specialized per type so nothing branches per element.
+enum class ScanValueType {
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    Float,
+    Double
+};
+
+//! Byte width of a scan value type.
+size_t scanValueSize(ScanValueType type);
+
+//! A wildcarded byte signature parsed from text like "8B 81 ?? ?? 00 00".
+//! `mask[i]` is 1 for bytes that must match and 0 for wildcards; `anchor` is
+//! the offset of the fixed byte the SIMD search keys on.
+struct ByteSignature {
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+    size_t anchor = 0;
+
+    bool empty() const { return bytes.empty(); }
 };
 
+//! Parses a space-separated signature string. Tokens are two-digit hex bytes
+//! or "?"/"??" wildcards. Returns nullopt for malformed tokens or patterns
+//! with no fixed byte to anchor on.
+std::optional<ByteSignature> parseSignature(const std::string& text);
+
+//! Target encoding of a text needle built with makeStringSignature.
+enum class StringEncoding {
+    Utf8,
+    Utf16
+};
+
+//! Builds a fully-fixed signature from a text needle, encoded as the target
+//! stores it (UTF-8 bytes or UTF-16LE code units). Returns an empty signature
+//! for empty text.
+ByteSignature makeStringSignature(const std::string& text, StringEncoding encoding);
+
 class MemoryScanner {
 public:
     explicit MemoryScanner(HANDLE process = nullptr);
@@ -37,25 +110,182 @@ public:
     //! Creates a snapshot from a base address and length.
     std::optional<MemorySnapshot> takeSnapshot(uintptr_t base, size_t size);
 
-    //! Compares two snapshots and returns candidate addresses matching the expected delta.
-    std::vector<uintptr_t> compareSnapshots(const MemorySnapshot& previous, const MemorySnapshot& current, int expectedDelta);
+    //! Walks the target's region map and returns all committed MEM_PRIVATE writable
+    //! regions, with adjacent compatible regions merged. Guard and image pages are skipped.
+    std::vector<MemoryRegion> queryWritableRegions() const;
+
+    //! Snapshots every writable private region in the target in one pass.
+    //! Unreadable pages truncate only the region they belong to, never the whole scan.
+    std::optional<FullSnapshot> takeFullSnapshot();
+
+    //! Walks the target's region map and returns all committed, readable
+    //! MEM_IMAGE regions (module code and data), with contiguous regions merged.
+    std::vector<MemoryRegion> queryImageRegions() const;
+
+    //! Searches every module image for a wildcarded signature, parallelized
+    //! across regions with the SIMD anchor-byte kernel. Matches are absolute
+    //! addresses in ascending order.
+    std::vector<uintptr_t> findSignature(const ByteSignature& signature) const;
+
+    //! Searches every writable private region for a signature — typically a
+    //! string or array-of-bytes needle. Regions are split into 4 MiB chunks
+    //! (overlapped by the pattern length so boundary matches are kept) and
+    //! spread across the worker pool, each chunk running the SIMD anchor-byte
+    //! kernel. Matches are absolute addresses in ascending order.
+    std::vector<uintptr_t> searchBytes(const ByteSignature& signature) const;
+
+    //! Launches a writable-memory byte search on the scan worker thread and
+    //! publishes the matches for searchResults().
+    bool startByteSearchAsync(const ByteSignature& signature);
+
+    //! Matches of the last completed byte search.
+    std::vector<uintptr_t> searchResults() const;
 
-    //! Filters candidate addresses by scanning for an exact value.
-    std::vector<uintptr_t> filterCandidates(const std::vector<uintptr_t>& candidates, int expectedValue);
+    //! Match count as of the last completed byte search.
+    size_t searchResultCount() const { return m_searchResultCount.load(); }
 
-    //! Adds a freeze entry that will be maintained in the background.
-    void freezeValue(uintptr_t address, const void* buffer, size_t size);
+    //! Launches a pointer-chain search on the scan worker thread: snapshots
+    //! every writable region, builds the reverse pointer map over it, then
+    //! walks backwards from `target` to module-rooted chains. The module list
+    //! comes from the ProcessManager cache at launch time.
+    bool startChainSearchAsync(uintptr_t target, std::vector<ModuleRegion> modules);
 
-    //! Stops all freeze operations.
-    void clearFreezes();
+    //! Chains found by the last completed chain search, shallowest first.
+    std::vector<PointerChain> chainResults() const;
+
+    //! Chain count as of the last completed chain search.
+    size_t chainResultCount() const { return m_chainResultCount.load(); }
+
+    //! Compares two snapshots and returns the candidate set matching the expected delta.
+    CandidateSet compareSnapshots(const MemorySnapshot& previous, const MemorySnapshot& current, int expectedDelta);
+
+    //! Narrows a candidate set in place by re-reading the target and keeping
+    //! slots equal to the expected value. Instantiated for every ScanValueType.
+    template <typename T>
+    void filterCandidates(CandidateSet& candidates, T expectedValue);
+
+    //! Narrows a candidate set in place, keeping slots whose live value lies in
+    //! [low, high]. Ranged, approximate and truncated-equality scans all reduce
+    //! to an interval; dense float/double runs go through the vectorized range
+    //! kernels, so fuzzy scans match exact-scan throughput.
+    template <typename T>
+    void filterCandidatesRange(CandidateSet& candidates, T low, T high);
+
+    //! Launches a ranged narrowing of the active session's candidates on the
+    //! scan worker thread, dispatching on the session's value type. Integer
+    //! sessions round the bounds inward to whole values; bounds outside the
+    //! type's range saturate, so an unreachable interval keeps nothing.
+    bool startValueFilterAsync(double low, double high);
+
+    //! Begins an unknown-initial-value session: baselines every writable private
+    //! region into a memory-mapped temp file and marks every slot as a candidate.
+    //! The value type fixes the slot width for the whole session.
+    bool beginUnknownScan(ScanValueType valueType = ScanValueType::Int32);
+
+    //! Refines the active session against live memory, keeping slots whose value
+    //! moved the expected way and updating the baseline to the fresh values.
+    void refineScan(ScanRefineMode mode);
+
+    //! True while an unknown-value session holds a baseline.
+    bool hasScanSession() const { return m_session.active; }
+
+    //! Value type fixed for the active session; callers freezing a candidate
+    //! must encode their payload as this type.
+    ScanValueType sessionValueType() const { return m_session.valueType; }
+
+    //! Candidates of the active unknown-value session.
+    CandidateSet& scanCandidates() { return m_session.candidates; }
+
+    //! Ends the session and releases the mapped baseline.
+    void endScan();
+
+    //! Persists the active session as one binary file: header, region table,
+    //! page hashes and candidate bitmaps, then the raw baseline bytes at a
+    //! page-aligned offset. Saving is a single sequential write.
+    bool saveScanSession(const std::filesystem::path& path);
+
+    //! Resumes a saved session by mapping the file in place: the mapping
+    //! becomes the session baseline directly (region offsets point past the
+    //! header), so load cost is independent of candidate count. Refinement
+    //! passes after a load update the file, keeping it current.
+    bool loadScanSession(const std::filesystem::path& path);
+
+    //! Launches the unknown-value baseline capture on the scan worker thread.
+    bool startUnknownScanAsync(ScanValueType valueType = ScanValueType::Int32);
+
+    //! Launches a refinement pass on the scan worker thread.
+    bool startRefineAsync(ScanRefineMode mode);
+
+    //! Requests cancellation of the in-flight scan job; the pass stops at the
+    //! next region or chunk boundary.
+    void cancelScan() { m_scanCancel = true; }
+
+    //! True while a scan job runs on the worker thread. The GUI polls this each
+    //! frame instead of ever blocking on scan work.
+    bool isScanning() const { return m_scanActive.load(); }
+
+    //! Progress of the in-flight job in [0, 1], published as chunks complete.
+    float scanProgress() const { return m_scanProgress.load(); }
+
+    //! Candidate count as of the last completed pass.
+    size_t candidateCount() const { return m_candidateCount.load(); }
+
+    //! Lowest candidate addresses, cached when the last pass completed.
+    std::vector<uintptr_t> topCandidates() const;
 
 private:
-    void freezeLoop();
+    //! Baseline state of an unknown-initial-value scan. The region table and
+    //! candidate bitmap stay in RAM; the captured bytes live in the mapped file.
+    struct UnknownScanSession {
+        std::vector<MemoryRegion> regions;
+        std::vector<size_t> regionOffsets;
+        //! Per-region hash of each 4 KiB page as of the last capture; refinement
+        //! passes short-circuit whole pages whose hash is unchanged.
+        std::vector<std::vector<uint64_t>> regionPageHashes;
+        MappedFileBuffer baseline;
+        //! Session file the baseline was resumed from, when it was; saving to
+        //! this path updates the live mapping in place instead of rewriting a
+        //! file the mapping itself holds open.
+        std::filesystem::path sourcePath;
+        CandidateSet candidates;
+        ScanValueType valueType = ScanValueType::Int32;
+        bool active = false;
+    };
+
+    size_t readRegionBytes(const MemoryRegion& region, uint8_t* dest) const;
+    bool startScanJob(std::function<void()> job);
+    void publishScanResults();
+
+    //! Type-specialized refinement pass; `keeps(previous, current)` is inlined
+    //! into the specialized loop, so the per-element code carries no dispatch.
+    template <typename T, typename Keeps>
+    void refinePass(Keeps keeps, bool keepsOnCleanPage);
+
+    template <typename T>
+    void refineDispatch(ScanRefineMode mode);
+
+    //! Rounds fuzzy-filter bounds inward (integer types) and saturates them to
+    //! T's range before dispatching to filterCandidatesRange; casting an
+    //! out-of-range double is undefined behaviour, not a clamp.
+    template <typename T>
+    void filterClampedRange(double low, double high);
+
+    UnknownScanSession m_session;
+    //! Backs per-pass scratch buffers. Reset (memory recycled) at the start
+    //! of each pass, released wholesale when the session ends.
+    Arena m_scanArena;
+    std::thread m_scanThread;
+    std::atomic<bool> m_scanActive{false};
+    std::atomic<bool> m_scanCancel{false};
+    std::atomic<float> m_scanProgress{0.0f};
+    std::atomic<size_t> m_candidateCount{0};
+    mutable std::mutex m_resultsMutex;
+    std::vector<uintptr_t> m_topCandidates;
+    std::vector<uintptr_t> m_searchResults;
+    std::atomic<size_t> m_searchResultCount{0};
+    std::vector<PointerChain> m_chainResults;
+    std::atomic<size_t> m_chainResultCount{0};
 
     HANDLE m_process = nullptr;
-    std::vector<FreezeEntry> m_freezeEntries;
-    std::thread m_freezeThread;
-    std::atomic<bool> m_freezeRequested{false};
-    mutable std::mutex m_freezeMutex;
 };
 
@@ -2,6 +2,7 @@
 
 #include <windows.h>
 
+#include <chrono>
 #include <string>
 
 class BaseMod {
@@ -9,7 +10,14 @@ public:
     virtual void onAttach(HANDLE process) {}
     virtual void onDetach() {}
     virtual void onTick() {}
+    //! Delivered after (re)attach for every configured signature that resolved;
+    //! `name` is the key from the process config's "signatures" table. Mods
+    //! that recognise a name can restore their addresses without a manual scan.
+    virtual void onAddressResolved(const std::string& name, uintptr_t address) {}
     virtual const char* getName() { return "Unnamed"; }
+    //! Desired tick cadence. The scheduler runs onTick no more often than
+    //! this; most mods maintain values the freeze service refreshes anyway.
+    virtual std::chrono::milliseconds tickInterval() const { return std::chrono::milliseconds(50); }
     virtual bool isCompatible(const std::string& processName) { return !processName.empty(); }
     virtual ~BaseMod() = default;
 
@@ -12,12 +12,11 @@ GodModeMod::GodModeMod() {
 
 void GodModeMod::onAttach(HANDLE process) {
     m_process = process;
-    m_scanner.setProcess(process);
     util::Logger::instance().log(util::Logger::Level::Info, "God Mode attached");
 }
 
 void GodModeMod::onDetach() {
-    m_scanner.clearFreezes();
+    FreezeService::instance().clearOwner(getName());
     m_lastAddress = 0;
     util::Logger::instance().log(util::Logger::Level::Info, "God Mode detached");
 }
@@ -26,13 +25,20 @@ bool GodModeMod::isCompatible(const std::string& processName) {
     return !processName.empty();
 }
 
+void GodModeMod::onAddressResolved(const std::string& name, uintptr_t address) {
+    if (name == "godmode.health") {
+        m_lastAddress = address;
+        util::Logger::instance().log(util::Logger::Level::Info, "God Mode health address restored from signature");
+    }
+}
+
 void GodModeMod::onTick() {
     if (!m_enabled || !m_process) {
         return;
     }
 
     if (m_lastAddress != 0) {
-        m_scanner.freezeValue(m_lastAddress, &kDesiredHealth, sizeof(kDesiredHealth));
+        FreezeService::instance().freeze(getName(), m_lastAddress, &kDesiredHealth, sizeof(kDesiredHealth));
         return;
     }
 
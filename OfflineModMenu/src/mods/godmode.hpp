@@ -2,7 +2,7 @@
 
 #include "base_mod.hpp"
 
-#include "../memory.hpp"
+#include "../freeze_service.hpp"
 #include "../utils.hpp"
 
 class GodModeMod : public BaseMod {
@@ -12,11 +12,11 @@ public:
     void onAttach(HANDLE process) override;
     void onDetach() override;
     void onTick() override;
+    void onAddressResolved(const std::string& name, uintptr_t address) override;
     const char* getName() override { return "God Mode"; }
     bool isCompatible(const std::string& processName) override;
 
 private:
-    MemoryScanner m_scanner;
     uintptr_t m_lastAddress = 0;
 };
 
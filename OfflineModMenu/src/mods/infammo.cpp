@@ -10,12 +10,11 @@ InfAmmoMod::InfAmmoMod() {
 
 void InfAmmoMod::onAttach(HANDLE process) {
     m_process = process;
-    m_scanner.setProcess(process);
     util::Logger::instance().log(util::Logger::Level::Info, "Infinity Ammo attached");
 }
 
 void InfAmmoMod::onDetach() {
-    m_scanner.clearFreezes();
+    FreezeService::instance().clearOwner(getName());
     m_lastAddress = 0;
     m_maxAmmo = 0;
     util::Logger::instance().log(util::Logger::Level::Info, "Infinity Ammo detached");
@@ -33,7 +32,7 @@ void InfAmmoMod::onTick() {
     int desiredAmmo = m_maxAmmo > 0 ? m_maxAmmo : kDefaultAmmo;
 
     if (m_lastAddress != 0) {
-        m_scanner.freezeValue(m_lastAddress, &desiredAmmo, sizeof(desiredAmmo));
+        FreezeService::instance().freeze(getName(), m_lastAddress, &desiredAmmo, sizeof(desiredAmmo));
         return;
     }
 
@@ -2,7 +2,7 @@
 
 #include "base_mod.hpp"
 
-#include "../memory.hpp"
+#include "../freeze_service.hpp"
 #include "../utils.hpp"
 
 class InfAmmoMod : public BaseMod {
@@ -16,7 +16,6 @@ public:
     bool isCompatible(const std::string& processName) override;
 
 private:
-    MemoryScanner m_scanner;
     uintptr_t m_lastAddress = 0;
     int m_maxAmmo = 0;
 };
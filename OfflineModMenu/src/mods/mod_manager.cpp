@@ -2,18 +2,52 @@
 
 #include "godmode.hpp"
 #include "infammo.hpp"
+#include "plugin_mod.hpp"
 
+#include "../perf.hpp"
+#include "../pointer_map.hpp"
 #include "../utils.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <memory>
 
 namespace {
+//! Batched plugin reads bridge gaps up to this size so near-adjacent watches
+//! share one ReadProcessMemory, and cap each run to bound the scratch buffer.
+constexpr size_t kWatchGapBridgeBytes = 4096;
+constexpr size_t kWatchRunCapBytes = 64 * 1024;
+
+//! Per-frame time budget for mod ticks. Due mods that do not fit carry over
+//! to the next frame, so the render loop never stalls on mod work.
+constexpr std::chrono::milliseconds kTickFrameBudget{2};
+
 std::shared_ptr<BaseMod> createModInstance(const std::filesystem::path& path) {
-    // Placeholder for future dynamic mod loading (DLL or script).
-    // Currently the project only ships with static mods compiled in.
-    util::Logger::instance().log(util::Logger::Level::Info, "Discovered placeholder mod file: " + path.string());
-    return nullptr;
+    if (util::toLower(path.extension().string()) != ".dll") {
+        return nullptr;
+    }
+    return PluginMod::load(path);
+}
+
+//! One plugin watch flattened into the cross-plugin batch.
+struct WatchRef {
+    size_t modIndex = 0;
+    OmmWatch watch;
+};
+
+//! Renders an address as "module+0x..." via the module cache when it falls
+//! inside a module, or as a raw hex address otherwise.
+std::string describeAddress(const ProcessManager& processManager, uintptr_t address) {
+    char buffer[80];
+    if (const auto moduleOffset = processManager.moduleOffsetOf(address)) {
+        std::snprintf(buffer, sizeof(buffer), "%s+0x%llX", moduleOffset->first.c_str(),
+                      static_cast<unsigned long long>(moduleOffset->second));
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "0x%llX", static_cast<unsigned long long>(address));
+    }
+    return buffer;
 }
 }
 
@@ -23,6 +57,8 @@ ModManager::ModManager() {
 
 void ModManager::discoverMods() {
     m_mods.clear();
+    m_tickStats.clear();
+    m_nextTickIndex = 0;
 
     // Built-in mods compiled directly into the application.
     m_mods.push_back(std::make_shared<GodModeMod>());
@@ -39,9 +75,12 @@ void ModManager::discoverMods() {
             m_mods.push_back(std::move(mod));
         }
     }
+
+    m_tickStats.resize(m_mods.size());
 }
 
 void ModManager::attachAll(HANDLE process, const std::string& processName) {
+    m_process = process;
     for (auto& mod : m_mods) {
         if (mod && mod->isCompatible(processName)) {
             mod->onAttach(process);
@@ -49,19 +88,199 @@ void ModManager::attachAll(HANDLE process, const std::string& processName) {
     }
 }
 
+void ModManager::resolveAddresses(MemoryScanner& scanner, const ProcessManager& processManager, const ProcessConfig& config) {
+    // Chains first: re-resolving one is a handful of reads against the module
+    // cache, versus a full image scan per signature.
+    for (const auto& [name, text] : config.chains) {
+        const auto chain = parseChain(text);
+        if (!chain) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Malformed pointer chain in config: " + name);
+            continue;
+        }
+
+        const auto address = resolveChain(scanner, processManager, *chain);
+        if (!address) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Pointer chain did not resolve: " + name);
+            continue;
+        }
+
+        for (auto& mod : m_mods) {
+            if (mod) {
+                mod->onAddressResolved(name, *address);
+            }
+        }
+        util::Logger::instance().log(util::Logger::Level::Info,
+            "Resolved pointer chain " + name + " -> " + describeAddress(processManager, *address));
+    }
+
+    for (const auto& [name, text] : config.signatures) {
+        const auto signature = parseSignature(text);
+        if (!signature) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Malformed signature in config: " + name);
+            continue;
+        }
+
+        const std::vector<uintptr_t> matches = scanner.findSignature(*signature);
+        if (matches.empty()) {
+            util::Logger::instance().log(util::Logger::Level::Warning, "Signature resolved no matches: " + name);
+            continue;
+        }
+        if (matches.size() > 1) {
+            util::Logger::instance().log(util::Logger::Level::Warning,
+                "Signature " + name + " matched " + std::to_string(matches.size()) + " locations; using the first");
+        }
+
+        for (auto& mod : m_mods) {
+            if (mod) {
+                mod->onAddressResolved(name, matches.front());
+            }
+        }
+        util::Logger::instance().log(util::Logger::Level::Info,
+            "Resolved signature " + name + " at " + describeAddress(processManager, matches.front()));
+    }
+}
+
 void ModManager::detachAll() {
     for (auto& mod : m_mods) {
         if (mod) {
             mod->onDetach();
         }
     }
+    m_process = nullptr;
 }
 
 void ModManager::tick() {
-    for (auto& mod : m_mods) {
-        if (mod && mod->isEnabled()) {
-            mod->onTick();
+    ScopedPerfTimer tickTimer(PerfMonitor::Section::ModTick);
+    const auto frameStart = std::chrono::steady_clock::now();
+
+    // Round-robin from where the previous frame left off, so a budget cut
+    // never starves the same mods every frame.
+    for (size_t visited = 0; visited < m_mods.size(); ++visited) {
+        const size_t index = (m_nextTickIndex + visited) % m_mods.size();
+        auto& mod = m_mods[index];
+        if (!mod || !mod->isEnabled()) {
+            continue;
+        }
+
+        ModTickStats& stats = m_tickStats[index];
+        const auto now = std::chrono::steady_clock::now();
+        if (now < stats.nextDue) {
+            continue;
+        }
+
+        if (now - frameStart >= kTickFrameBudget) {
+            // Budget exhausted: everything still due this frame is deferred
+            // and the next frame resumes from here.
+            for (size_t rest = visited; rest < m_mods.size(); ++rest) {
+                const size_t restIndex = (m_nextTickIndex + rest) % m_mods.size();
+                auto& restMod = m_mods[restIndex];
+                if (restMod && restMod->isEnabled() && now >= m_tickStats[restIndex].nextDue) {
+                    ++m_tickStats[restIndex].deferrals;
+                }
+            }
+            m_nextTickIndex = index;
+            dispatchPluginUpdates();
+            return;
+        }
+
+        mod->onTick();
+        const auto elapsed = std::chrono::steady_clock::now() - now;
+        const float tickMs = std::chrono::duration<float, std::milli>(elapsed).count();
+
+        stats.lastTickMs = tickMs;
+        stats.maxTickMs = std::max(stats.maxTickMs, tickMs);
+        ++stats.ticks;
+        stats.nextDue = now + mod->tickInterval();
+    }
+
+    if (!m_mods.empty()) {
+        m_nextTickIndex = (m_nextTickIndex + 1) % m_mods.size();
+    }
+
+    dispatchPluginUpdates();
+}
+
+void ModManager::dispatchPluginUpdates() {
+    if (!m_process) {
+        return;
+    }
+    ScopedPerfTimer batchTimer(PerfMonitor::Section::PluginBatch);
+
+    // Gather every enabled plugin's watches into one flat batch. Plugins may
+    // change their watches between ticks, so this is re-queried every time.
+    std::vector<WatchRef> refs;
+    OmmWatch scratch[OMM_MAX_WATCHES];
+    for (size_t modIndex = 0; modIndex < m_mods.size(); ++modIndex) {
+        auto* plugin = dynamic_cast<PluginMod*>(m_mods[modIndex].get());
+        if (!plugin || !plugin->isEnabled() || !plugin->wantsUpdates()) {
+            continue;
+        }
+        const uint32_t count = plugin->collectWatches(scratch, OMM_MAX_WATCHES);
+        for (uint32_t i = 0; i < count; ++i) {
+            refs.push_back(WatchRef{ modIndex, scratch[i] });
+        }
+    }
+    if (refs.empty()) {
+        return;
+    }
+
+    std::sort(refs.begin(), refs.end(), [](const WatchRef& a, const WatchRef& b) {
+        return a.watch.address < b.watch.address;
+    });
+
+    // Coalesce sorted watches into ranged reads: one syscall covers every
+    // watch within the bridge distance, regardless of which plugin owns it.
+    std::vector<std::vector<OmmValueUpdate>> updates(m_mods.size());
+    std::vector<uint8_t> runBuffer;
+    size_t runBegin = 0;
+    while (runBegin < refs.size()) {
+        const uintptr_t runBase = static_cast<uintptr_t>(refs[runBegin].watch.address);
+        size_t runEnd = runBegin + 1;
+        uintptr_t runLimit = runBase + refs[runBegin].watch.size;
+        while (runEnd < refs.size()) {
+            const uintptr_t address = static_cast<uintptr_t>(refs[runEnd].watch.address);
+            const uintptr_t end = address + refs[runEnd].watch.size;
+            if (address > runLimit + kWatchGapBridgeBytes || end - runBase > kWatchRunCapBytes) {
+                break;
+            }
+            runLimit = std::max(runLimit, end);
+            ++runEnd;
+        }
+
+        runBuffer.resize(runLimit - runBase);
+        SIZE_T bytesRead = 0;
+        PerfMonitor::instance().add(PerfMonitor::Counter::PluginReads, 1);
+        const bool runValid = ReadProcessMemory(m_process, reinterpret_cast<LPCVOID>(runBase),
+                                                runBuffer.data(), runBuffer.size(), &bytesRead) &&
+                              bytesRead == runBuffer.size();
+
+        for (size_t i = runBegin; i < runEnd; ++i) {
+            const WatchRef& ref = refs[i];
+            OmmValueUpdate update{};
+            update.slot = ref.watch.slot;
+            update.size = ref.watch.size;
+            if (runValid) {
+                update.valid = 1;
+                std::memcpy(update.bytes, runBuffer.data() + (ref.watch.address - runBase), ref.watch.size);
+            } else {
+                // The run straddled an unreadable page; retry just this watch.
+                SIZE_T watchRead = 0;
+                update.valid = ReadProcessMemory(m_process, reinterpret_cast<LPCVOID>(static_cast<uintptr_t>(ref.watch.address)),
+                                                 update.bytes, ref.watch.size, &watchRead) &&
+                                 watchRead == ref.watch.size ? 1 : 0;
+            }
+            updates[ref.modIndex].push_back(update);
+        }
+
+        runBegin = runEnd;
+    }
+
+    for (size_t modIndex = 0; modIndex < m_mods.size(); ++modIndex) {
+        if (updates[modIndex].empty()) {
+            continue;
         }
+        auto* plugin = static_cast<PluginMod*>(m_mods[modIndex].get());
+        plugin->deliverUpdates(updates[modIndex].data(), static_cast<uint32_t>(updates[modIndex].size()));
     }
 }
 
@@ -2,13 +2,30 @@
 
 #include "base_mod.hpp"
 
+#include "../config.hpp"
+#include "../memory.hpp"
+
 #include <windows.h>
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <vector>
 #include <string>
 
+class ProcessManager;
+
+//! Per-mod scheduling state and tick-cost instrumentation, indexed like mods().
+struct ModTickStats {
+    std::chrono::steady_clock::time_point nextDue{};
+    float lastTickMs = 0.0f;
+    float maxTickMs = 0.0f;
+    uint64_t ticks = 0;
+    //! Times the mod was due but pushed to a later frame by the budget.
+    uint64_t deferrals = 0;
+};
+
 class ModManager {
 public:
     ModManager();
@@ -22,14 +39,33 @@ public:
     //! Invoked when detaching from a process.
     void detachAll();
 
-    //! Runs per-frame updates for enabled mods.
+    //! Resolves every configured signature against the target's module images
+    //! and every configured pointer chain against live memory, fanning the
+    //! addresses out to the mods via onAddressResolved. Run after each
+    //! (re)attach so mods get their addresses back without a manual scan.
+    void resolveAddresses(MemoryScanner& scanner, const ProcessManager& processManager, const ProcessConfig& config);
+
+    //! Runs due mods within the per-frame time budget. Mods declare their
+    //! cadence via BaseMod::tickInterval(); work that does not fit in this
+    //! frame's budget carries over round-robin, so frame time stays bounded
+    //! regardless of mod count.
     void tick();
 
+    //! Tick-cost instrumentation, parallel to mods().
+    const std::vector<ModTickStats>& tickStats() const { return m_tickStats; }
+
     //! Returns the loaded mods.
     std::vector<std::shared_ptr<BaseMod>>& mods() { return m_mods; }
 
 private:
+    //! Reads every enabled plugin's watched addresses in one coalesced batch
+    //! and fans the values back out, once per tick.
+    void dispatchPluginUpdates();
+
     std::filesystem::path m_modDirectory;
     std::vector<std::shared_ptr<BaseMod>> m_mods;
+    std::vector<ModTickStats> m_tickStats;
+    size_t m_nextTickIndex = 0;
+    HANDLE m_process = nullptr;
 };
 
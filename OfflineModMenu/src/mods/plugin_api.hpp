@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+
+//! C ABI for drop-in mod plugins loaded from the /mods directory.
+//!
+//! Plugins are plain DLLs built with any compiler. Instead of each plugin
+//! issuing its own ReadProcessMemory calls, a plugin declares the addresses
+//! it watches and the host delivers batched value updates once per tick from
+//! shared, coalesced reads — ten plugins cost roughly the same syscall
+//! budget as one.
+//!
+//! Required export:
+//!   const OmmPluginInfo* ommGetPluginInfo(void);
+//! Optional exports:
+//!   void     ommOnAttach(const char* processName);
+//!   void     ommOnDetach(void);
+//!   void     ommOnTick(void);
+//!   uint32_t ommDescribeWatches(OmmWatch* out, uint32_t capacity);
+//!   void     ommOnUpdate(const OmmValueUpdate* updates, uint32_t count);
+
+#define OMM_PLUGIN_API_VERSION 1u
+
+//! Upper bound on watches a single plugin may declare per tick.
+#define OMM_MAX_WATCHES 256u
+
+extern "C" {
+
+//! One watched location. The slot is a plugin-chosen identifier handed back
+//! unchanged in the matching OmmValueUpdate.
+struct OmmWatch {
+    uint64_t address;
+    uint32_t size; // bytes, at most 8
+    uint32_t slot;
+};
+
+//! One delivered value. Size mirrors the watch; bytes beyond it are zero.
+//! valid is 0 when the read failed (e.g. the page was decommitted).
+struct OmmValueUpdate {
+    uint32_t slot;
+    uint32_t size;
+    uint32_t valid;
+    uint8_t bytes[8];
+};
+
+struct OmmPluginInfo {
+    uint32_t apiVersion; // must be OMM_PLUGIN_API_VERSION
+    const char* name;    // static storage owned by the plugin
+};
+
+typedef const OmmPluginInfo* (*OmmGetPluginInfoFn)(void);
+typedef void (*OmmOnAttachFn)(const char* processName);
+typedef void (*OmmOnDetachFn)(void);
+typedef void (*OmmOnTickFn)(void);
+typedef uint32_t (*OmmDescribeWatchesFn)(OmmWatch* out, uint32_t capacity);
+typedef void (*OmmOnUpdateFn)(const OmmValueUpdate* updates, uint32_t count);
+
+} // extern "C"
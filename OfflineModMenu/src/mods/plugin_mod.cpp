@@ -0,0 +1,87 @@
+#include "plugin_mod.hpp"
+
+#include "../utils.hpp"
+
+std::shared_ptr<PluginMod> PluginMod::load(const std::filesystem::path& path) {
+    HMODULE library = LoadLibraryW(path.c_str());
+    if (!library) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Failed to load mod DLL: " + path.filename().string());
+        return nullptr;
+    }
+
+    auto getInfo = reinterpret_cast<OmmGetPluginInfoFn>(GetProcAddress(library, "ommGetPluginInfo"));
+    const OmmPluginInfo* info = getInfo ? getInfo() : nullptr;
+    if (!info || !info->name) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Not a mod plugin (no ommGetPluginInfo): " + path.filename().string());
+        FreeLibrary(library);
+        return nullptr;
+    }
+    if (info->apiVersion != OMM_PLUGIN_API_VERSION) {
+        util::Logger::instance().log(util::Logger::Level::Warning,
+            "Plugin " + std::string(info->name) + " targets API v" + std::to_string(info->apiVersion) +
+            ", host speaks v" + std::to_string(OMM_PLUGIN_API_VERSION));
+        FreeLibrary(library);
+        return nullptr;
+    }
+
+    auto mod = std::shared_ptr<PluginMod>(new PluginMod());
+    mod->m_library = library;
+    mod->m_name = info->name;
+    mod->m_onAttach = reinterpret_cast<OmmOnAttachFn>(GetProcAddress(library, "ommOnAttach"));
+    mod->m_onDetach = reinterpret_cast<OmmOnDetachFn>(GetProcAddress(library, "ommOnDetach"));
+    mod->m_onTick = reinterpret_cast<OmmOnTickFn>(GetProcAddress(library, "ommOnTick"));
+    mod->m_describeWatches = reinterpret_cast<OmmDescribeWatchesFn>(GetProcAddress(library, "ommDescribeWatches"));
+    mod->m_onUpdate = reinterpret_cast<OmmOnUpdateFn>(GetProcAddress(library, "ommOnUpdate"));
+
+    util::Logger::instance().log(util::Logger::Level::Info, "Loaded mod plugin: " + mod->m_name);
+    return mod;
+}
+
+PluginMod::~PluginMod() {
+    if (m_library) {
+        FreeLibrary(m_library);
+    }
+}
+
+void PluginMod::onAttach(HANDLE process) {
+    m_process = process;
+    if (m_onAttach) {
+        m_onAttach(m_name.c_str());
+    }
+}
+
+void PluginMod::onDetach() {
+    if (m_onDetach) {
+        m_onDetach();
+    }
+    m_process = nullptr;
+}
+
+void PluginMod::onTick() {
+    if (m_onTick) {
+        m_onTick();
+    }
+}
+
+uint32_t PluginMod::collectWatches(OmmWatch* out, uint32_t capacity) {
+    if (!m_describeWatches) {
+        return 0;
+    }
+    uint32_t count = m_describeWatches(out, capacity);
+    if (count > capacity) {
+        count = capacity;
+    }
+    // Clamp sizes so a misbehaving plugin cannot push reads past its slots.
+    for (uint32_t i = 0; i < count; ++i) {
+        if (out[i].size == 0 || out[i].size > sizeof(OmmValueUpdate::bytes)) {
+            out[i].size = sizeof(OmmValueUpdate::bytes);
+        }
+    }
+    return count;
+}
+
+void PluginMod::deliverUpdates(const OmmValueUpdate* updates, uint32_t count) {
+    if (m_onUpdate) {
+        m_onUpdate(updates, count);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "base_mod.hpp"
+#include "plugin_api.hpp"
+
+#include <windows.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+//! BaseMod adapter around a DLL plugin from the /mods directory.
+//!
+//! The plugin never reads target memory itself: each tick the manager asks it
+//! for its watch list, performs the reads as part of one coalesced batch over
+//! all plugins, and hands the values back through deliverUpdates.
+class PluginMod : public BaseMod {
+public:
+    //! Loads and validates a plugin DLL; nullptr when the file is not a
+    //! plugin (missing info export) or was built against another API version.
+    static std::shared_ptr<PluginMod> load(const std::filesystem::path& path);
+
+    ~PluginMod() override;
+
+    void onAttach(HANDLE process) override;
+    void onDetach() override;
+    void onTick() override;
+    const char* getName() override { return m_name.c_str(); }
+
+    //! Fills the plugin's current watch list; returns the watch count.
+    //! Plugins may change their watches between ticks (e.g. after resolving
+    //! a pointer chain), so this is queried every batch.
+    uint32_t collectWatches(OmmWatch* out, uint32_t capacity);
+
+    bool wantsUpdates() const { return m_onUpdate != nullptr; }
+    void deliverUpdates(const OmmValueUpdate* updates, uint32_t count);
+
+private:
+    PluginMod() = default;
+
+    HMODULE m_library = nullptr;
+    std::string m_name;
+
+    OmmOnAttachFn m_onAttach = nullptr;
+    OmmOnDetachFn m_onDetach = nullptr;
+    OmmOnTickFn m_onTick = nullptr;
+    OmmDescribeWatchesFn m_describeWatches = nullptr;
+    OmmOnUpdateFn m_onUpdate = nullptr;
+};
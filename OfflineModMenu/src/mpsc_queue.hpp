@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+//! Bounded lock-free multi-producer, single-consumer queue (Vyukov-style
+//! sequence cells). Producers never block and never take a lock; the single
+//! consumer drains with tryPop. Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class MpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    //! Attempts to enqueue; returns false when the queue is full.
+    bool tryPush(T item) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &m_cells[pos & (Capacity - 1)];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = std::move(item);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Dequeues one item; must only ever be called from the consumer thread.
+    bool tryPop(T& out) {
+        Cell* cell = &m_cells[m_head & (Capacity - 1)];
+        const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_head + 1);
+        if (diff < 0) {
+            return false;
+        }
+        out = std::move(cell->item);
+        cell->sequence.store(m_head + Capacity, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T item;
+    };
+
+    Cell m_cells[Capacity];
+    std::atomic<size_t> m_tail{0};
+    size_t m_head = 0; // consumer-owned
+};
@@ -0,0 +1,23 @@
+#include "perf.hpp"
+
+PerfMonitor& PerfMonitor::instance() {
+    static PerfMonitor monitor;
+    return monitor;
+}
+
+void PerfMonitor::record(Section section, uint64_t micros) {
+    SectionStats& stats = m_sections[static_cast<size_t>(section)];
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.totalMicros.fetch_add(micros, std::memory_order_relaxed);
+    stats.lastMicros.store(micros, std::memory_order_relaxed);
+
+    size_t bucket = 0;
+    for (uint64_t value = micros; value > 1 && bucket < kHistogramBuckets - 1; value >>= 1) {
+        ++bucket;
+    }
+    stats.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerfMonitor::add(Counter counter, uint64_t amount) {
+    m_counters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+//! Lightweight always-on instrumentation for hot paths.
+//!
+//! record() is a handful of relaxed atomic adds, cheap enough to stay enabled
+//! in release builds. The Perf tab reads the stats directly and derives rates
+//! frame-side, so the instrumented paths never aggregate anything themselves.
+class PerfMonitor {
+public:
+    //! Timed subsystems. Durations land in a per-section log2 histogram.
+    enum class Section : size_t {
+        Frame,
+        ScanPass,
+        FreezeCycle,
+        ModTick,
+        PluginBatch,
+        Count
+    };
+
+    //! Monotonic event counters; the Perf tab turns deltas into rates.
+    enum class Counter : size_t {
+        ScanBytes,
+        FreezeReads,
+        FreezeWrites,
+        PluginReads,
+        Count
+    };
+
+    static constexpr size_t kHistogramBuckets = 16;
+
+    struct SectionStats {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> totalMicros{0};
+        std::atomic<uint64_t> lastMicros{0};
+        //! Bucket i counts samples in [2^i, 2^(i+1)) microseconds.
+        std::atomic<uint64_t> buckets[kHistogramBuckets];
+    };
+
+    static PerfMonitor& instance();
+
+    void record(Section section, uint64_t micros);
+    void add(Counter counter, uint64_t amount);
+
+    const SectionStats& section(Section section) const {
+        return m_sections[static_cast<size_t>(section)];
+    }
+    uint64_t counter(Counter counter) const {
+        return m_counters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+private:
+    PerfMonitor() = default;
+
+    SectionStats m_sections[static_cast<size_t>(Section::Count)];
+    std::atomic<uint64_t> m_counters[static_cast<size_t>(Counter::Count)] = {};
+};
+
+//! RAII timer recording its lifetime into a PerfMonitor section.
+class ScopedPerfTimer {
+public:
+    explicit ScopedPerfTimer(PerfMonitor::Section section)
+        : m_section(section), m_start(std::chrono::steady_clock::now()) {}
+
+    ScopedPerfTimer(const ScopedPerfTimer&) = delete;
+    ScopedPerfTimer& operator=(const ScopedPerfTimer&) = delete;
+
+    ~ScopedPerfTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        PerfMonitor::instance().record(m_section,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+    }
+
+private:
+    PerfMonitor::Section m_section;
+    std::chrono::steady_clock::time_point m_start;
+};
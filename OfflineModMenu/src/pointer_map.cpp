@@ -0,0 +1,224 @@
+#include "pointer_map.hpp"
+
+#include "utils.hpp"
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+// Collection chunk size; multiples of the pointer width so chunks never split a slot.
+constexpr size_t kBuildChunkBytes = 4 * 1024 * 1024;
+
+//! One unit of parallel collection work: a byte range within one region.
+struct BuildChunk {
+    size_t regionIndex = 0;
+    size_t begin = 0;
+    size_t end = 0;
+};
+} // namespace
+
+void PointerMap::build(const FullSnapshot& snapshot, const std::vector<ModuleRegion>& modules) {
+    m_entries.clear();
+    m_modules = modules;
+
+    // Cheap prefilter bounds: anything outside every captured region and every
+    // module cannot be a pointer of interest, and most values fail this test.
+    uintptr_t lowBound = UINTPTR_MAX;
+    uintptr_t highBound = 0;
+    for (const auto& region : snapshot.regions) {
+        lowBound = std::min(lowBound, region.base);
+        highBound = std::max(highBound, region.base + region.size);
+    }
+    for (const auto& module : m_modules) {
+        lowBound = std::min(lowBound, module.base);
+        highBound = std::max(highBound, module.base + module.size);
+    }
+    if (lowBound >= highBound) {
+        return;
+    }
+
+    std::vector<BuildChunk> chunks;
+    for (size_t regionIndex = 0; regionIndex < snapshot.regions.size(); ++regionIndex) {
+        const size_t regionSize = snapshot.regions[regionIndex].size;
+        for (size_t begin = 0; begin < regionSize; begin += kBuildChunkBytes) {
+            chunks.push_back(BuildChunk{ regionIndex, begin, std::min(begin + kBuildChunkBytes, regionSize) });
+        }
+    }
+
+    std::vector<std::vector<Entry>> chunkEntries(chunks.size());
+    WorkerPool::instance().parallelFor(chunks.size(), [&](size_t chunkIndex) {
+        const BuildChunk& chunk = chunks[chunkIndex];
+        const MemoryRegion& region = snapshot.regions[chunk.regionIndex];
+        const uint8_t* data = snapshot.data.data() + snapshot.regionOffsets[chunk.regionIndex];
+        std::vector<Entry>& local = chunkEntries[chunkIndex];
+
+        for (size_t offset = chunk.begin; offset + sizeof(uintptr_t) <= chunk.end; offset += sizeof(uintptr_t)) {
+            uintptr_t value = 0;
+            std::memcpy(&value, data + offset, sizeof(value));
+            if (value < lowBound || value >= highBound) {
+                continue;
+            }
+            // The bounds pass; confirm the value lands in a captured region or module.
+            if (!snapshot.offsetOf(value).has_value() && !moduleContaining(value)) {
+                continue;
+            }
+            local.push_back(Entry{ value, region.base + offset });
+        }
+    });
+
+    size_t total = 0;
+    for (const auto& local : chunkEntries) {
+        total += local.size();
+    }
+    m_entries.reserve(total);
+    for (const auto& local : chunkEntries) {
+        m_entries.insert(m_entries.end(), local.begin(), local.end());
+    }
+
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) {
+        return a.target != b.target ? a.target < b.target : a.location < b.location;
+    });
+
+    util::Logger::instance().log(util::Logger::Level::Info,
+        "Pointer map built: " + std::to_string(m_entries.size()) + " pointers, " +
+        std::to_string((m_entries.size() * sizeof(Entry)) / (1024 * 1024)) + " MiB");
+}
+
+std::pair<const PointerMap::Entry*, const PointerMap::Entry*> PointerMap::pointersInto(uintptr_t begin, uintptr_t end) const {
+    auto lower = std::lower_bound(m_entries.begin(), m_entries.end(), begin, [](const Entry& entry, uintptr_t addr) {
+        return entry.target < addr;
+    });
+    auto upper = std::lower_bound(lower, m_entries.end(), end, [](const Entry& entry, uintptr_t addr) {
+        return entry.target < addr;
+    });
+    return { m_entries.data() + (lower - m_entries.begin()), m_entries.data() + (upper - m_entries.begin()) };
+}
+
+const ModuleRegion* PointerMap::moduleContaining(uintptr_t address) const {
+    auto it = std::upper_bound(m_modules.begin(), m_modules.end(), address, [](uintptr_t addr, const ModuleRegion& module) {
+        return addr < module.base;
+    });
+    if (it == m_modules.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (address >= it->base + it->size) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+std::vector<PointerChain> PointerMap::findChains(uintptr_t target, size_t maxDepth,
+                                                 uintptr_t maxOffset, size_t limit) const {
+    std::vector<PointerChain> results;
+    std::vector<uintptr_t> trail;
+    // Shallower chains are more stable across runs, so widen the depth one
+    // level at a time instead of diving straight to maxDepth.
+    for (size_t depth = 1; depth <= maxDepth && results.size() < limit; ++depth) {
+        findChainsFrom(target, depth, maxOffset, limit, trail, results);
+    }
+    return results;
+}
+
+void PointerMap::findChainsFrom(uintptr_t address, size_t depth, uintptr_t maxOffset, size_t limit,
+                                std::vector<uintptr_t>& trail, std::vector<PointerChain>& results) const {
+    if (results.size() >= limit) {
+        return;
+    }
+
+    const uintptr_t rangeBegin = address > maxOffset ? address - maxOffset : 0;
+    auto [entry, end] = pointersInto(rangeBegin, address + 1);
+    for (; entry != end && results.size() < limit; ++entry) {
+        const uintptr_t hopOffset = address - entry->target;
+
+        // Emit static roots only at the leaf level of the current deepening
+        // pass; shorter chains through the same root were already emitted by
+        // an earlier, shallower pass.
+        if (depth == 1) {
+            if (const ModuleRegion* module = moduleContaining(entry->location)) {
+                PointerChain chain;
+                chain.module = module->name;
+                chain.offsets.push_back(entry->location - module->base);
+                chain.offsets.push_back(hopOffset);
+                for (auto it = trail.rbegin(); it != trail.rend(); ++it) {
+                    chain.offsets.push_back(*it);
+                }
+                results.push_back(std::move(chain));
+            }
+            continue;
+        }
+
+        trail.push_back(hopOffset);
+        findChainsFrom(entry->location, depth - 1, maxOffset, limit, trail, results);
+        trail.pop_back();
+    }
+}
+
+std::string formatChain(const PointerChain& chain) {
+    std::string text = chain.module;
+    char buffer[32];
+    for (size_t i = 0; i < chain.offsets.size(); ++i) {
+        std::snprintf(buffer, sizeof(buffer), i == 0 ? "+0x%llX" : " 0x%llX",
+                      static_cast<unsigned long long>(chain.offsets[i]));
+        text += buffer;
+    }
+    return text;
+}
+
+std::optional<PointerChain> parseChain(const std::string& text) {
+    const size_t plus = text.find('+');
+    if (plus == std::string::npos || plus == 0) {
+        return std::nullopt;
+    }
+
+    PointerChain chain;
+    chain.module = util::toLower(text.substr(0, plus));
+
+    size_t i = plus + 1;
+    while (i <= text.size()) {
+        size_t tokenEnd = text.find(' ', i);
+        if (tokenEnd == std::string::npos) {
+            tokenEnd = text.size();
+        }
+        std::string token = text.substr(i, tokenEnd - i);
+        if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+            token.erase(0, 2);
+        }
+        if (token.empty() || !std::all_of(token.begin(), token.end(), [](char c) {
+                return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+            })) {
+            return std::nullopt;
+        }
+        chain.offsets.push_back(static_cast<uintptr_t>(std::stoull(token, nullptr, 16)));
+        i = tokenEnd + 1;
+    }
+    return chain;
+}
+
+std::optional<uintptr_t> resolveChain(const MemoryScanner& scanner,
+                                      const ProcessManager& processManager,
+                                      const PointerChain& chain) {
+    if (chain.offsets.empty()) {
+        return std::nullopt;
+    }
+
+    // The root is a plain cache lookup; only the hops touch target memory.
+    const auto root = processManager.resolveModuleAddress(chain.module, chain.offsets[0]);
+    if (!root) {
+        util::Logger::instance().log(util::Logger::Level::Warning, "Chain module not loaded: " + chain.module);
+        return std::nullopt;
+    }
+
+    uintptr_t address = *root;
+    for (size_t hop = 1; hop < chain.offsets.size(); ++hop) {
+        uintptr_t value = 0;
+        if (!scanner.read(address, &value, sizeof(value))) {
+            return std::nullopt;
+        }
+        address = value + chain.offsets[hop];
+    }
+    return address;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "memory.hpp"
+#include "process.hpp"
+
+#include <windows.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! A saved module-relative pointer chain. Resolution starts at the module
+//! base plus offsets[0] and dereferences once per remaining hop: the value
+//! read there plus offsets[1] is dereferenced next, and so on. The final sum
+//! is the resolved address and is not dereferenced.
+struct PointerChain {
+    std::string module;
+    std::vector<uintptr_t> offsets;
+};
+
+//! Reverse index over every aligned pointer-sized value in a snapshot that
+//! points back into the captured regions or a module image.
+//!
+//! Entries are a flat array sorted by target address: 16 bytes per pointer,
+//! built in parallel across the pool, and queried by binary search. The
+//! sorted layout is what makes chain search cheap — "who points near this
+//! address" is a range query, which a hash layout cannot answer.
+class PointerMap {
+public:
+    struct Entry {
+        uintptr_t target = 0;
+        uintptr_t location = 0;
+    };
+
+    //! Builds the map from a full snapshot. Collection is parallelized in
+    //! 4 MiB chunks; the single sort afterwards dominates on large targets.
+    void build(const FullSnapshot& snapshot, const std::vector<ModuleRegion>& modules);
+
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+
+    //! Entries whose stored value lies in [begin, end), as a contiguous span
+    //! of the sorted array.
+    std::pair<const Entry*, const Entry*> pointersInto(uintptr_t begin, uintptr_t end) const;
+
+    //! Searches backwards from `target` for chains rooted in a module image,
+    //! allowing hop offsets up to maxOffset. Stops after `limit` chains;
+    //! shallow chains are found first.
+    std::vector<PointerChain> findChains(uintptr_t target, size_t maxDepth,
+                                         uintptr_t maxOffset, size_t limit) const;
+
+private:
+    const ModuleRegion* moduleContaining(uintptr_t address) const;
+    void findChainsFrom(uintptr_t address, size_t depth, uintptr_t maxOffset, size_t limit,
+                        std::vector<uintptr_t>& trail, std::vector<PointerChain>& results) const;
+
+    std::vector<Entry> m_entries;
+    std::vector<ModuleRegion> m_modules;
+};
+
+//! Formats a chain as config text, e.g. "game.exe+0x17E0A8 0x10 0x8".
+std::string formatChain(const PointerChain& chain);
+
+//! Parses the formatChain text form. Returns nullopt for malformed input.
+std::optional<PointerChain> parseChain(const std::string& text);
+
+//! Re-resolves a saved chain against live memory, rooting it via the process
+//! manager's module cache. Returns nullopt when the module is not loaded or
+//! any hop reads an unmapped pointer.
+std::optional<uintptr_t> resolveChain(const MemoryScanner& scanner,
+                                      const ProcessManager& processManager,
+                                      const PointerChain& chain);
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <unordered_set>
 
 namespace {
@@ -16,58 +17,146 @@ const std::unordered_set<std::string> kBlockedNames = {
     "apex.exe",
     "overwatch.exe"
 };
+
+// Cadence of the background process watcher. Each pass is a single cheap
+// EnumProcesses; name lookups only happen for PIDs not seen before.
+constexpr std::chrono::milliseconds kWatchInterval{1500};
 }
 
-ProcessManager::ProcessManager() = default;
+std::vector<ModuleRegion> enumerateModules(HANDLE process) {
+    std::vector<ModuleRegion> modules;
+    if (!process) {
+        return modules;
+    }
+
+    std::array<HMODULE, 1024> handles{};
+    DWORD bytesNeeded = 0;
+    if (!EnumProcessModulesEx(process, handles.data(), static_cast<DWORD>(handles.size() * sizeof(HMODULE)),
+                              &bytesNeeded, LIST_MODULES_ALL)) {
+        util::Logger::instance().log(util::Logger::Level::Error, "Failed to enumerate target modules");
+        return modules;
+    }
 
-std::vector<ProcessInfo> ProcessManager::enumerate() {
-    std::vector<ProcessInfo> processes;
-    DWORD processIds[1024] = {};
-    DWORD bytesReturned = 0;
+    const DWORD moduleCount = std::min<DWORD>(bytesNeeded / sizeof(HMODULE), static_cast<DWORD>(handles.size()));
+    modules.reserve(moduleCount);
+    for (DWORD i = 0; i < moduleCount; ++i) {
+        std::array<wchar_t, MAX_PATH> nameBuffer{};
+        MODULEINFO info{};
+        if (!GetModuleBaseNameW(process, handles[i], nameBuffer.data(), static_cast<DWORD>(nameBuffer.size())) ||
+            !GetModuleInformation(process, handles[i], &info, sizeof(info))) {
+            continue;
+        }
 
-    if (!EnumProcesses(processIds, sizeof(processIds), &bytesReturned)) {
-        util::Logger::instance().log(util::Logger::Level::Error, "Failed to enumerate processes");
-        return processes;
+        ModuleRegion module;
+        module.name = util::toLower(util::wideToUtf8(nameBuffer.data()));
+        module.base = reinterpret_cast<uintptr_t>(info.lpBaseOfDll);
+        module.size = info.SizeOfImage;
+        modules.push_back(std::move(module));
     }
 
-    const DWORD processCount = bytesReturned / sizeof(DWORD);
-    processes.reserve(processCount);
+    std::sort(modules.begin(), modules.end(), [](const ModuleRegion& a, const ModuleRegion& b) {
+        return a.base < b.base;
+    });
+    return modules;
+}
+
+ProcessManager::ProcessManager() {
+    m_watcherRunning = true;
+    m_watcher = std::thread(&ProcessManager::watcherMain, this);
+}
 
-    for (DWORD i = 0; i < processCount; ++i) {
-        DWORD pid = processIds[i];
-        if (pid == 0) {
+ProcessManager::~ProcessManager() {
+    m_watcherRunning = false;
+    if (m_watcher.joinable()) {
+        m_watcher.join();
+    }
+}
+
+std::vector<ProcessInfo> ProcessManager::processList() const {
+    std::lock_guard<std::mutex> lock(m_listMutex);
+    return m_processList;
+}
+
+void ProcessManager::watcherMain() {
+    while (m_watcherRunning.load()) {
+        DWORD processIds[1024] = {};
+        DWORD bytesReturned = 0;
+        if (!EnumProcesses(processIds, sizeof(processIds), &bytesReturned)) {
+            util::Logger::instance().log(util::Logger::Level::Error, "Failed to enumerate processes");
+            std::this_thread::sleep_for(kWatchInterval);
             continue;
         }
 
-        HANDLE handle = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ, FALSE, pid);
-        if (!handle) {
-            continue;
+        const DWORD processCount = bytesReturned / sizeof(DWORD);
+        std::unordered_set<DWORD> seen;
+        seen.reserve(processCount);
+        bool changed = false;
+
+        // Only PIDs we have not seen before pay for OpenProcess + name lookup.
+        for (DWORD i = 0; i < processCount; ++i) {
+            const DWORD pid = processIds[i];
+            if (pid == 0) {
+                continue;
+            }
+            seen.insert(pid);
+            if (m_knownProcesses.count(pid) != 0) {
+                continue;
+            }
+
+            HANDLE handle = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ, FALSE, pid);
+            if (!handle) {
+                continue;
+            }
+
+            std::array<wchar_t, MAX_PATH> nameBuffer{};
+            if (GetModuleBaseNameW(handle, nullptr, nameBuffer.data(), static_cast<DWORD>(nameBuffer.size()))) {
+                ProcessInfo info;
+                info.pid = pid;
+                info.name = util::wideToUtf8(nameBuffer.data());
+                info.sortKey = util::toLower(info.name);
+                info.blocked = isBlockedProcess(info.name);
+                m_knownProcesses.emplace(pid, std::move(info));
+                changed = true;
+            }
+            CloseHandle(handle);
         }
 
-        std::array<wchar_t, MAX_PATH> nameBuffer{};
-        if (GetModuleBaseNameW(handle, nullptr, nameBuffer.data(), static_cast<DWORD>(nameBuffer.size()))) {
-            std::string utf8Name = util::wideToUtf8(nameBuffer.data());
-            ProcessInfo info;
-            info.pid = pid;
-            info.name = utf8Name;
-            info.blocked = isBlockedProcess(utf8Name);
-            processes.emplace_back(std::move(info));
+        for (auto it = m_knownProcesses.begin(); it != m_knownProcesses.end();) {
+            if (seen.count(it->first) == 0) {
+                it = m_knownProcesses.erase(it);
+                changed = true;
+            } else {
+                ++it;
+            }
         }
 
-        CloseHandle(handle);
-    }
+        if (changed) {
+            std::vector<ProcessInfo> sorted;
+            sorted.reserve(m_knownProcesses.size());
+            for (const auto& [pid, info] : m_knownProcesses) {
+                sorted.push_back(info);
+            }
+            // Precomputed keys make this an allocation-free comparison.
+            std::sort(sorted.begin(), sorted.end(), [](const ProcessInfo& a, const ProcessInfo& b) {
+                return a.sortKey < b.sortKey;
+            });
 
-    std::sort(processes.begin(), processes.end(), [](const ProcessInfo& a, const ProcessInfo& b) {
-        return util::toLower(a.name) < util::toLower(b.name);
-    });
+            {
+                std::lock_guard<std::mutex> lock(m_listMutex);
+                m_processList = std::move(sorted);
+            }
+            m_listVersion.fetch_add(1);
+        }
 
-    return processes;
+        std::this_thread::sleep_for(kWatchInterval);
+    }
 }
 
 bool ProcessManager::attach(DWORD pid) {
     reset();
 
-    HANDLE handle = OpenProcess(PROCESS_VM_READ | PROCESS_VM_WRITE | PROCESS_VM_OPERATION | PROCESS_QUERY_INFORMATION, FALSE, pid);
+    // SYNCHRONIZE lets pollTarget() detect target exit by waiting on the handle.
+    HANDLE handle = OpenProcess(PROCESS_VM_READ | PROCESS_VM_WRITE | PROCESS_VM_OPERATION | PROCESS_QUERY_INFORMATION | SYNCHRONIZE, FALSE, pid);
     if (!handle) {
         util::Logger::instance().log(util::Logger::Level::Error, "Unable to open target process handle");
         return false;
@@ -89,17 +178,100 @@ bool ProcessManager::attach(DWORD pid) {
 
     m_processHandle = handle;
     m_currentProcessName = utf8Name;
+    m_reattachName = utf8Name;
+    m_attachVersion.fetch_add(1);
+    refreshModules();
     util::Logger::instance().log(util::Logger::Level::Info, "Attached to process: " + utf8Name);
     return true;
 }
 
+void ProcessManager::pollTarget() {
+    if (m_processHandle) {
+        // A signalled process handle means the target exited; release it and
+        // start hunting for a replacement instance by name.
+        if (WaitForSingleObject(m_processHandle, 0) == WAIT_OBJECT_0) {
+            const std::string lostName = m_currentProcessName;
+            util::Logger::instance().log(util::Logger::Level::Warning,
+                "Target process exited; watching for a new instance of " + lostName);
+            reset();
+            m_reattachName = lostName;
+            m_reattachListVersion = m_listVersion.load();
+        }
+        return;
+    }
+
+    if (m_reattachName.empty()) {
+        return;
+    }
+
+    // Rescan only when the watcher has published a fresh list; a restarted
+    // target shows up there within one watch interval.
+    const uint64_t version = m_listVersion.load();
+    if (version == m_reattachListVersion) {
+        return;
+    }
+    m_reattachListVersion = version;
+
+    const std::string key = util::toLower(m_reattachName);
+    for (const auto& proc : processList()) {
+        if (proc.sortKey == key && !proc.blocked) {
+            if (attach(proc.pid)) {
+                util::Logger::instance().log(util::Logger::Level::Info,
+                    "Reattached to restarted target: " + proc.name);
+            }
+            return;
+        }
+    }
+}
+
+std::vector<ModuleRegion> ProcessManager::modules() const {
+    std::lock_guard<std::mutex> lock(m_moduleMutex);
+    return m_modules;
+}
+
+void ProcessManager::refreshModules() {
+    std::vector<ModuleRegion> fresh = enumerateModules(m_processHandle);
+    std::unordered_map<std::string, size_t> index;
+    index.reserve(fresh.size());
+    for (size_t i = 0; i < fresh.size(); ++i) {
+        index.emplace(fresh[i].name, i);
+    }
+
+    std::lock_guard<std::mutex> lock(m_moduleMutex);
+    m_modules = std::move(fresh);
+    m_moduleIndex = std::move(index);
+}
+
+std::optional<uintptr_t> ProcessManager::resolveModuleAddress(const std::string& moduleName, uintptr_t offset) const {
+    std::lock_guard<std::mutex> lock(m_moduleMutex);
+    auto it = m_moduleIndex.find(util::toLower(moduleName));
+    if (it == m_moduleIndex.end()) {
+        return std::nullopt;
+    }
+    return m_modules[it->second].base + offset;
+}
+
+std::optional<std::pair<std::string, uintptr_t>> ProcessManager::moduleOffsetOf(uintptr_t address) const {
+    std::lock_guard<std::mutex> lock(m_moduleMutex);
+    auto it = std::upper_bound(m_modules.begin(), m_modules.end(), address, [](uintptr_t addr, const ModuleRegion& module) {
+        return addr < module.base;
+    });
+    if (it == m_modules.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    if (address >= it->base + it->size) {
+        return std::nullopt;
+    }
+    return std::make_pair(it->name, address - it->base);
+}
+
 void ProcessManager::detach() {
     if (m_processHandle) {
-        CloseHandle(m_processHandle);
-        m_processHandle = nullptr;
         util::Logger::instance().log(util::Logger::Level::Info, "Detached from process");
     }
-    m_currentProcessName.clear();
+    reset();
+    m_reattachName.clear();
 }
 
 std::optional<std::string> ProcessManager::currentProcessName() const {
@@ -117,7 +289,12 @@ void ProcessManager::reset() {
     if (m_processHandle) {
         CloseHandle(m_processHandle);
         m_processHandle = nullptr;
+        m_attachVersion.fetch_add(1);
     }
     m_currentProcessName.clear();
+
+    std::lock_guard<std::mutex> lock(m_moduleMutex);
+    m_modules.clear();
+    m_moduleIndex.clear();
 }
 
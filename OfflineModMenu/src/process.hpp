@@ -2,29 +2,67 @@
 
 #include <windows.h>
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <optional>
 
+//! A module loaded in the target process. Offsets expressed against a module
+//! base survive ASLR and game restarts, unlike raw absolute addresses.
+struct ModuleRegion {
+    std::string name;
+    uintptr_t base = 0;
+    size_t size = 0;
+};
+
+//! Enumerates the target's loaded modules (lowercase base names), sorted by base.
+std::vector<ModuleRegion> enumerateModules(HANDLE process);
+
 struct ProcessInfo {
     DWORD pid = 0;
     std::string name;
+    //! Lowercase name, computed once at discovery for sorting and search.
+    std::string sortKey;
     bool blocked = false;
 };
 
 class ProcessManager {
 public:
     ProcessManager();
+    ~ProcessManager();
 
-    //! Enumerates running processes and caches the result.
-    std::vector<ProcessInfo> enumerate();
+    //! Snapshot of the watched process list, sorted by lowercase name. The
+    //! background watcher keeps it current; reading it never blocks on
+    //! process enumeration.
+    std::vector<ProcessInfo> processList() const;
+
+    //! Monotonic version of the watched list; bumps when it changes, so the
+    //! GUI can skip copying an unchanged list.
+    uint64_t processListVersion() const { return m_listVersion.load(); }
 
     //! Attempts to attach to a specific process ID.
     bool attach(DWORD pid);
 
-    //! Detaches from the current process and releases handles.
+    //! Detaches from the current process and releases handles. Also forgets
+    //! the reattach target, so a deliberate detach stays detached.
     void detach();
 
+    //! Called once per frame from the main loop. Detects target exit via the
+    //! handle and, once the watcher's list shows a new instance of the same
+    //! executable, reattaches automatically. Handle transitions all happen on
+    //! the caller's thread; the watcher only supplies the list.
+    void pollTarget();
+
+    //! Monotonic attach generation; bumps whenever the attached handle changes
+    //! (attach, detach, or target exit), so the main loop can rewire the
+    //! scanner, freeze service and mods exactly once per transition.
+    uint64_t attachVersion() const { return m_attachVersion.load(); }
+
     //! Returns whether the manager currently has an attached handle.
     bool isAttached() const { return m_processHandle != nullptr; }
 
@@ -34,13 +72,50 @@ public:
     //! Returns the currently attached process name if available.
     std::optional<std::string> currentProcessName() const;
 
+    //! Modules of the attached target, cached at attach(). Copy under lock.
+    std::vector<ModuleRegion> modules() const;
+
+    //! Re-enumerates the target's modules, e.g. after a late DLL load. attach()
+    //! calls this once; there is no cross-process load notification to hook.
+    void refreshModules();
+
+    //! Translates module+offset to an absolute address from the cache — an
+    //! in-memory hash lookup, safe on hot paths.
+    std::optional<uintptr_t> resolveModuleAddress(const std::string& moduleName, uintptr_t offset) const;
+
+    //! Expresses an absolute address as module+offset when it falls inside a
+    //! cached module (binary search over the sorted cache).
+    std::optional<std::pair<std::string, uintptr_t>> moduleOffsetOf(uintptr_t address) const;
+
     //! Returns true if the provided process name is known to be disallowed.
     static bool isBlockedProcess(const std::string& name);
 
 private:
     void reset();
+    void watcherMain();
 
     HANDLE m_processHandle = nullptr;
     std::string m_currentProcessName;
+    std::atomic<uint64_t> m_attachVersion{0};
+
+    //! Executable name to hunt for after the target exits; set on every
+    //! successful attach, cleared by a deliberate detach. pollTarget() only
+    //! rescans when the watcher publishes a new list.
+    std::string m_reattachName;
+    uint64_t m_reattachListVersion = UINT64_MAX;
+
+    //! Background watcher state. The watcher owns m_knownProcesses; only the
+    //! published sorted list is shared, under m_listMutex.
+    std::thread m_watcher;
+    std::atomic<bool> m_watcherRunning{false};
+    std::unordered_map<DWORD, ProcessInfo> m_knownProcesses;
+    mutable std::mutex m_listMutex;
+    std::vector<ProcessInfo> m_processList;
+    std::atomic<uint64_t> m_listVersion{0};
+
+    //! Module cache of the attached target, rebuilt by refreshModules().
+    mutable std::mutex m_moduleMutex;
+    std::vector<ModuleRegion> m_modules;
+    std::unordered_map<std::string, size_t> m_moduleIndex;
 };
 
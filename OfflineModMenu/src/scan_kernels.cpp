@@ -0,0 +1,289 @@
+#include "scan_kernels.hpp"
+
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SCAN_KERNELS_HAVE_AVX2 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <immintrin.h>
+#define SCAN_KERNELS_HAVE_AVX2 1
+#else
+#define SCAN_KERNELS_HAVE_AVX2 0
+#endif
+
+namespace scan {
+
+namespace {
+
+bool detectAvx2() {
+#if defined(_MSC_VER)
+    int info[4] = {};
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0; // EBX bit 5: AVX2
+#elif SCAN_KERNELS_HAVE_AVX2
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (ebx & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+const bool kHasAvx2 = detectAvx2();
+
+inline unsigned int lowestSetBit(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+void deltaCompareI32Scalar(const uint8_t* prev, const uint8_t* curr, size_t valueCount,
+                           int expectedDelta, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    for (size_t value = 0; value < valueCount; ++value) {
+        const int prevValue = *reinterpret_cast<const int*>(prev + value * sizeof(int));
+        const int currValue = *reinterpret_cast<const int*>(curr + value * sizeof(int));
+        if (currValue - prevValue == expectedDelta) {
+            out.push_back(baseAddress + value * sizeof(int));
+        }
+    }
+}
+
+#if SCAN_KERNELS_HAVE_AVX2
+#if defined(__GNUC__) && !defined(__AVX2__)
+__attribute__((target("avx2")))
+#endif
+void deltaCompareI32Avx2(const uint8_t* prev, const uint8_t* curr, size_t valueCount,
+                         int expectedDelta, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    const __m256i delta = _mm256_set1_epi32(expectedDelta);
+    size_t value = 0;
+
+    for (; value + 8 <= valueCount; value += 8) {
+        const __m256i prevLanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prev + value * sizeof(int)));
+        const __m256i currLanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(curr + value * sizeof(int)));
+        const __m256i diff = _mm256_sub_epi32(currLanes, prevLanes);
+        const __m256i match = _mm256_cmpeq_epi32(diff, delta);
+
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+        while (mask != 0) {
+            const unsigned int lane = lowestSetBit(mask);
+            out.push_back(baseAddress + (value + lane) * sizeof(int));
+            mask &= mask - 1;
+        }
+    }
+
+    // Scalar tail for the final partial vector.
+    deltaCompareI32Scalar(prev + value * sizeof(int), curr + value * sizeof(int),
+                          valueCount - value, expectedDelta, baseAddress + value * sizeof(int), out);
+}
+#endif
+
+void rangeCompareF32Scalar(const uint8_t* data, size_t valueCount, float low, float high,
+                           uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    for (size_t value = 0; value < valueCount; ++value) {
+        float lane = 0.0f;
+        std::memcpy(&lane, data + value * sizeof(float), sizeof(lane));
+        if (lane >= low && lane <= high) {
+            out.push_back(baseAddress + value * sizeof(float));
+        }
+    }
+}
+
+void rangeCompareF64Scalar(const uint8_t* data, size_t valueCount, double low, double high,
+                           uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    for (size_t value = 0; value < valueCount; ++value) {
+        double lane = 0.0;
+        std::memcpy(&lane, data + value * sizeof(double), sizeof(lane));
+        if (lane >= low && lane <= high) {
+            out.push_back(baseAddress + value * sizeof(double));
+        }
+    }
+}
+
+#if SCAN_KERNELS_HAVE_AVX2
+#if defined(__GNUC__) && !defined(__AVX2__)
+__attribute__((target("avx2")))
+#endif
+void rangeCompareF32Avx2(const uint8_t* data, size_t valueCount, float low, float high,
+                         uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    const __m256 lowLanes = _mm256_set1_ps(low);
+    const __m256 highLanes = _mm256_set1_ps(high);
+    size_t value = 0;
+
+    for (; value + 8 <= valueCount; value += 8) {
+        const __m256 lanes = _mm256_loadu_ps(reinterpret_cast<const float*>(data + value * sizeof(float)));
+        const __m256 inRange = _mm256_and_ps(_mm256_cmp_ps(lanes, lowLanes, _CMP_GE_OQ),
+                                             _mm256_cmp_ps(lanes, highLanes, _CMP_LE_OQ));
+
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(inRange));
+        while (mask != 0) {
+            const unsigned int lane = lowestSetBit(mask);
+            out.push_back(baseAddress + (value + lane) * sizeof(float));
+            mask &= mask - 1;
+        }
+    }
+
+    // Scalar tail for the final partial vector.
+    rangeCompareF32Scalar(data + value * sizeof(float), valueCount - value, low, high,
+                          baseAddress + value * sizeof(float), out);
+}
+
+#if defined(__GNUC__) && !defined(__AVX2__)
+__attribute__((target("avx2")))
+#endif
+void rangeCompareF64Avx2(const uint8_t* data, size_t valueCount, double low, double high,
+                         uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    const __m256d lowLanes = _mm256_set1_pd(low);
+    const __m256d highLanes = _mm256_set1_pd(high);
+    size_t value = 0;
+
+    for (; value + 4 <= valueCount; value += 4) {
+        const __m256d lanes = _mm256_loadu_pd(reinterpret_cast<const double*>(data + value * sizeof(double)));
+        const __m256d inRange = _mm256_and_pd(_mm256_cmp_pd(lanes, lowLanes, _CMP_GE_OQ),
+                                              _mm256_cmp_pd(lanes, highLanes, _CMP_LE_OQ));
+
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(inRange));
+        while (mask != 0) {
+            const unsigned int lane = lowestSetBit(mask);
+            out.push_back(baseAddress + (value + lane) * sizeof(double));
+            mask &= mask - 1;
+        }
+    }
+
+    // Scalar tail for the final partial vector.
+    rangeCompareF64Scalar(data + value * sizeof(double), valueCount - value, low, high,
+                          baseAddress + value * sizeof(double), out);
+}
+#endif
+
+inline bool patternMatchesAt(const uint8_t* data, const uint8_t* pattern, const uint8_t* mask, size_t patternSize) {
+    for (size_t i = 0; i < patternSize; ++i) {
+        if (mask[i] != 0 && data[i] != pattern[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void patternSearchScalar(const uint8_t* data, size_t size,
+                         const uint8_t* pattern, const uint8_t* mask, size_t patternSize,
+                         size_t anchor, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    if (size < patternSize) {
+        return;
+    }
+    const uint8_t anchorByte = pattern[anchor];
+    const size_t positions = size - patternSize + 1;
+    const uint8_t* search = data + anchor;
+    const uint8_t* searchEnd = search + positions;
+    while (search < searchEnd) {
+        const uint8_t* hit = static_cast<const uint8_t*>(
+            std::memchr(search, anchorByte, static_cast<size_t>(searchEnd - search)));
+        if (!hit) {
+            break;
+        }
+        const uint8_t* candidate = hit - anchor;
+        if (patternMatchesAt(candidate, pattern, mask, patternSize)) {
+            out.push_back(baseAddress + static_cast<size_t>(candidate - data));
+        }
+        search = hit + 1;
+    }
+}
+
+#if SCAN_KERNELS_HAVE_AVX2
+#if defined(__GNUC__) && !defined(__AVX2__)
+__attribute__((target("avx2")))
+#endif
+void patternSearchAvx2(const uint8_t* data, size_t size,
+                       const uint8_t* pattern, const uint8_t* mask, size_t patternSize,
+                       size_t anchor, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+    if (size < patternSize) {
+        return;
+    }
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(pattern[anchor]));
+    const size_t positions = size - patternSize + 1;
+
+    size_t position = 0;
+    for (; position + 32 <= positions; position += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position + anchor));
+        unsigned int hits = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+        while (hits != 0) {
+            const unsigned int lane = lowestSetBit(hits);
+            const uint8_t* candidate = data + position + lane;
+            if (patternMatchesAt(candidate, pattern, mask, patternSize)) {
+                out.push_back(baseAddress + position + lane);
+            }
+            hits &= hits - 1;
+        }
+    }
+
+    // Scalar tail for the final partial vector of positions.
+    if (position < positions) {
+        patternSearchScalar(data + position, size - position, pattern, mask, patternSize,
+                            anchor, baseAddress + position, out);
+    }
+}
+#endif
+
+} // namespace
+
+bool usingAvx2() {
+#if SCAN_KERNELS_HAVE_AVX2
+    return kHasAvx2;
+#else
+    return false;
+#endif
+}
+
+void deltaCompareI32(const uint8_t* prev, const uint8_t* curr, size_t valueCount,
+                     int expectedDelta, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+#if SCAN_KERNELS_HAVE_AVX2
+    if (kHasAvx2) {
+        deltaCompareI32Avx2(prev, curr, valueCount, expectedDelta, baseAddress, out);
+        return;
+    }
+#endif
+    deltaCompareI32Scalar(prev, curr, valueCount, expectedDelta, baseAddress, out);
+}
+
+void rangeCompareF32(const uint8_t* data, size_t valueCount, float low, float high,
+                     uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+#if SCAN_KERNELS_HAVE_AVX2
+    if (kHasAvx2) {
+        rangeCompareF32Avx2(data, valueCount, low, high, baseAddress, out);
+        return;
+    }
+#endif
+    rangeCompareF32Scalar(data, valueCount, low, high, baseAddress, out);
+}
+
+void rangeCompareF64(const uint8_t* data, size_t valueCount, double low, double high,
+                     uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+#if SCAN_KERNELS_HAVE_AVX2
+    if (kHasAvx2) {
+        rangeCompareF64Avx2(data, valueCount, low, high, baseAddress, out);
+        return;
+    }
+#endif
+    rangeCompareF64Scalar(data, valueCount, low, high, baseAddress, out);
+}
+
+void patternSearch(const uint8_t* data, size_t size,
+                   const uint8_t* pattern, const uint8_t* mask, size_t patternSize,
+                   size_t anchor, uintptr_t baseAddress, std::vector<uintptr_t>& out) {
+#if SCAN_KERNELS_HAVE_AVX2
+    if (kHasAvx2) {
+        patternSearchAvx2(data, size, pattern, mask, patternSize, anchor, baseAddress, out);
+        return;
+    }
+#endif
+    patternSearchScalar(data, size, pattern, mask, patternSize, anchor, baseAddress, out);
+}
+
+} // namespace scan
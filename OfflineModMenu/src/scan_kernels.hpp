@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//! Hot scan kernels shared by the snapshot comparison paths.
+//!
+//! The AVX2 variants are selected once at startup from CPUID; machines without
+//! AVX2 fall back to the scalar loops transparently. Kernels append matching
+//! addresses in ascending order, so chunked callers can concatenate results.
+namespace scan {
+
+//! True when the selected kernels use AVX2; exposed for logging/instrumentation.
+bool usingAvx2();
+
+//! Appends baseAddress + i*4 for every 32-bit lane where curr - prev == expectedDelta.
+void deltaCompareI32(const uint8_t* prev, const uint8_t* curr, size_t valueCount,
+                     int expectedDelta, uintptr_t baseAddress, std::vector<uintptr_t>& out);
+
+//! Appends baseAddress + i*4 for every float lane with low <= value <= high.
+//! The compares are ordered, so NaN lanes never match. Ranged, approximate
+//! and truncated-equality predicates all reduce to an interval, so one kernel
+//! covers every fuzzy float scan.
+void rangeCompareF32(const uint8_t* data, size_t valueCount, float low, float high,
+                     uintptr_t baseAddress, std::vector<uintptr_t>& out);
+
+//! Appends baseAddress + i*8 for every double lane with low <= value <= high.
+void rangeCompareF64(const uint8_t* data, size_t valueCount, double low, double high,
+                     uintptr_t baseAddress, std::vector<uintptr_t>& out);
+
+//! Appends baseAddress + i for every position where the masked byte pattern
+//! matches (mask[i] == 0 means wildcard). The vector search keys on the fixed
+//! byte at `anchor`; the caller picks the rarest one so the per-hit full
+//! verification runs on as few positions as possible.
+void patternSearch(const uint8_t* data, size_t size,
+                   const uint8_t* pattern, const uint8_t* mask, size_t patternSize,
+                   size_t anchor, uintptr_t baseAddress, std::vector<uintptr_t>& out);
+
+} // namespace scan
@@ -3,7 +3,9 @@
 #include <windows.h>
 
 #include <algorithm>
+#include <chrono>
 #include <codecvt>
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -13,6 +15,10 @@ namespace util {
 
 namespace {
 constexpr const char* LEVEL_TAGS[] = {"INFO", "WARN", "ERR"};
+
+// Flush cadence for the background logger thread; batches everything queued
+// in the interval into one write on the persistent handle.
+constexpr std::chrono::milliseconds kLogFlushInterval{50};
 }
 
 void ensureDirectories(const std::vector<std::filesystem::path>& directories) {
@@ -65,18 +71,37 @@ Logger& Logger::instance() {
 
 Logger::Logger() {
     m_logPath = std::filesystem::current_path() / "log.txt";
-    appendToFile("==== Offline Mod Menu Log (OFFLINE USE ONLY) ====");
+    QueuedLine banner;
+    const int written = std::snprintf(banner.text, sizeof(banner.text), "==== Offline Mod Menu Log (OFFLINE USE ONLY) ====");
+    banner.length = static_cast<uint16_t>(written);
+    m_queue.tryPush(banner);
+    m_running = true;
+    m_flusher = std::thread(&Logger::flusherMain, this);
 }
 
-void Logger::log(Level level, const std::string& message) {
-    const std::string line = '[' + timeString() + "] [" + LEVEL_TAGS[static_cast<int>(level)] + "] " + message + " | OFFLINE USE ONLY";
-
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_entries.push_back(line);
-    appendToFile(line);
+Logger::~Logger() {
+    m_running = false;
+    if (m_flusher.joinable()) {
+        m_flusher.join();
+    }
+}
 
-    if (m_callback) {
-        m_callback(line);
+void Logger::log(Level level, const std::string& message) {
+    // One snprintf straight into the queue slot: no temporary strings, no
+    // ostringstream, no heap traffic on the hot path.
+    QueuedLine line;
+    SYSTEMTIME st{};
+    GetLocalTime(&st);
+    const int written = std::snprintf(line.text, sizeof(line.text),
+        "[%02u:%02u:%02u] [%s] %.*s | OFFLINE USE ONLY",
+        st.wHour, st.wMinute, st.wSecond, LEVEL_TAGS[static_cast<int>(level)],
+        static_cast<int>(message.size()), message.data());
+    line.length = static_cast<uint16_t>(std::min<size_t>(static_cast<size_t>(written), sizeof(line.text) - 1));
+
+    // Producers only touch the lock-free queue; the flusher thread owns the
+    // file handle, the entry buffer, and the GUI callback.
+    if (!m_queue.tryPush(line)) {
+        m_droppedLines.fetch_add(1);
     }
 }
 
@@ -90,10 +115,54 @@ void Logger::setRealtimeCallback(std::function<void(const std::string&)> callbac
     m_callback = std::move(callback);
 }
 
-void Logger::appendToFile(const std::string& line) {
+void Logger::flusherMain() {
+    // One open for the process lifetime; every flush interval drains the
+    // queue into a single batched write instead of an open/write/close per line.
     std::ofstream file(m_logPath, std::ios::app);
-    if (file.is_open()) {
-        file << line << '\n';
+
+    std::string fileBatch;
+    QueuedLine queued;
+    std::string line;
+    while (m_running.load()) {
+        fileBatch.clear();
+        while (m_queue.tryPop(queued)) {
+            line.assign(queued.text, queued.length);
+            deliver(line, fileBatch);
+        }
+
+        const size_t dropped = m_droppedLines.exchange(0);
+        if (dropped != 0) {
+            deliver('[' + timeString() + "] [WARN] Log queue overflow: " + std::to_string(dropped) + " lines dropped", fileBatch);
+        }
+
+        if (!fileBatch.empty() && file.is_open()) {
+            file << fileBatch;
+            file.flush();
+        }
+
+        std::this_thread::sleep_for(kLogFlushInterval);
+    }
+
+    // Final drain so shutdown messages reach the file.
+    fileBatch.clear();
+    while (m_queue.tryPop(queued)) {
+        line.assign(queued.text, queued.length);
+        deliver(line, fileBatch);
+    }
+    if (!fileBatch.empty() && file.is_open()) {
+        file << fileBatch;
+        file.flush();
+    }
+}
+
+void Logger::deliver(const std::string& line, std::string& fileBatch) {
+    fileBatch += line;
+    fileBatch += '\n';
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.push_back(line);
+    if (m_callback) {
+        m_callback(line);
     }
 }
 
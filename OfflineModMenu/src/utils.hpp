@@ -1,6 +1,10 @@
 #pragma once
 
+#include "mpsc_queue.hpp"
+
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 #include <mutex>
 #include <filesystem>
@@ -23,7 +27,13 @@ std::string toLower(const std::string& value);
 //! Returns the current time formatted as HH:MM:SS.
 std::string timeString();
 
-//! Thread-safe logger implementation used by the entire application.
+//! Thread-safe logger used by the entire application.
+//!
+//! log() formats the line and pushes it onto a bounded lock-free queue; a
+//! background flusher batches lines to a persistent file handle and feeds the
+//! GUI buffer/callback. Hot paths (freeze loop, scan passes) never touch the
+//! filesystem. When the queue is full the line is dropped and the flusher
+//! records how many were lost.
 class Logger {
 public:
     enum class Level {
@@ -35,18 +45,36 @@ public:
     //! Returns the global logger instance.
     static Logger& instance();
 
-    //! Appends a log entry to the log file and GUI buffer.
+    ~Logger();
+
+    //! Queues a log entry for the file and GUI buffer. The line is formatted
+    //! with one snprintf into a fixed-size queue slot, so the call allocates
+    //! nothing; messages longer than a slot are truncated rather than dropped.
     void log(Level level, const std::string& message);
 
     //! Retrieves a copy of the internal log buffer.
     std::vector<std::string> fetchEntries();
 
     //! Allows the GUI to register a callback to receive real-time log entries.
+    //! The callback runs on the flusher thread.
     void setRealtimeCallback(std::function<void(const std::string&)> callback);
 
 private:
+    //! Fixed-size queued line; producers fill it in place and the flusher
+    //! converts to std::string off the hot path.
+    struct QueuedLine {
+        char text[240] = {};
+        uint16_t length = 0;
+    };
+
     Logger();
-    void appendToFile(const std::string& line);
+    void flusherMain();
+    void deliver(const std::string& line, std::string& fileBatch);
+
+    MpscQueue<QueuedLine, 8192> m_queue;
+    std::thread m_flusher;
+    std::atomic<bool> m_running{false};
+    std::atomic<size_t> m_droppedLines{0};
 
     std::mutex m_mutex;
     std::vector<std::string> m_entries;
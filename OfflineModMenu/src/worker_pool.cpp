@@ -0,0 +1,128 @@
+#include "worker_pool.hpp"
+
+#include "utils.hpp"
+
+#include <algorithm>
+
+WorkerPool& WorkerPool::instance() {
+    static WorkerPool pool;
+    return pool;
+}
+
+WorkerPool::WorkerPool() {
+    const unsigned int hardware = std::thread::hardware_concurrency();
+    // The caller participates too, so spawn one fewer thread than cores.
+    const size_t workerThreads = hardware > 1 ? hardware - 1 : 1;
+
+    m_queues.reserve(workerThreads + 1);
+    for (size_t i = 0; i < workerThreads + 1; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerThreads);
+    for (size_t i = 0; i < workerThreads; ++i) {
+        m_workers.emplace_back(&WorkerPool::workerMain, this, i);
+    }
+
+    util::Logger::instance().log(util::Logger::Level::Info, "Worker pool started with " + std::to_string(workerThreads + 1) + " lanes");
+}
+
+WorkerPool::~WorkerPool() {
+    m_shutdown = true;
+    m_wakeCondition.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void WorkerPool::parallelFor(size_t chunkCount, const std::function<void(size_t)>& fn) {
+    if (chunkCount == 0) {
+        return;
+    }
+    if (chunkCount == 1) {
+        fn(0);
+        return;
+    }
+
+    std::lock_guard<std::mutex> jobLock(m_jobMutex);
+
+    {
+        std::lock_guard<std::mutex> stateLock(m_stateMutex);
+        m_activeFn.store(&fn);
+        m_remainingChunks = chunkCount;
+        m_unclaimedChunks = chunkCount;
+        // Seed chunks round-robin; stealing evens out any imbalance afterwards.
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            WorkQueue& queue = *m_queues[chunk % m_queues.size()];
+            std::lock_guard<std::mutex> queueLock(queue.mutex);
+            queue.chunks.push_back(chunk);
+        }
+    }
+    m_wakeCondition.notify_all();
+
+    // The calling thread drains the last queue slot alongside the workers.
+    const size_t callerQueue = m_queues.size() - 1;
+    while (tryRunChunk(callerQueue)) {
+    }
+
+    std::unique_lock<std::mutex> stateLock(m_stateMutex);
+    m_doneCondition.wait(stateLock, [this] { return m_remainingChunks.load() == 0; });
+    m_activeFn.store(nullptr);
+}
+
+void WorkerPool::workerMain(size_t workerIndex) {
+    while (!m_shutdown.load()) {
+        {
+            std::unique_lock<std::mutex> stateLock(m_stateMutex);
+            m_wakeCondition.wait(stateLock, [this] { return m_shutdown.load() || m_unclaimedChunks.load() > 0; });
+        }
+        if (m_shutdown.load()) {
+            return;
+        }
+
+        while (tryRunChunk(workerIndex)) {
+        }
+    }
+}
+
+bool WorkerPool::tryRunChunk(size_t preferredQueue) {
+    const std::function<void(size_t)>* fn = m_activeFn.load();
+    if (!fn || m_remainingChunks.load() == 0) {
+        return false;
+    }
+
+    size_t chunk = 0;
+    bool found = false;
+
+    // Pop from the back of our own queue first; steal from the front of others.
+    for (size_t attempt = 0; attempt < m_queues.size() && !found; ++attempt) {
+        WorkQueue& queue = *m_queues[(preferredQueue + attempt) % m_queues.size()];
+        std::lock_guard<std::mutex> queueLock(queue.mutex);
+        if (queue.chunks.empty()) {
+            continue;
+        }
+        if (attempt == 0) {
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+        } else {
+            chunk = queue.chunks.front();
+            queue.chunks.pop_front();
+        }
+        found = true;
+    }
+
+    if (!found) {
+        return false;
+    }
+    m_unclaimedChunks.fetch_sub(1);
+
+    (*fn)(chunk);
+
+    if (m_remainingChunks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> stateLock(m_stateMutex);
+        m_doneCondition.notify_all();
+    }
+    return true;
+}
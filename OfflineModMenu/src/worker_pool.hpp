@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! Persistent worker pool used by the scan engine for data-parallel passes.
+//!
+//! Chunks are seeded round-robin across per-worker deques; an idle worker steals
+//! from the front of its neighbours' deques, so regions of wildly different sizes
+//! still balance out. The calling thread participates in the work, and only one
+//! parallelFor runs at a time — the scan paths are already serialized above this.
+class WorkerPool {
+public:
+    //! Returns the process-wide pool, spun up lazily on first use.
+    static WorkerPool& instance();
+
+    ~WorkerPool();
+
+    //! Total number of threads that execute chunks (workers plus the caller).
+    size_t workerCount() const { return m_workers.size() + 1; }
+
+    //! Runs fn(chunkIndex) for every index in [0, chunkCount) and blocks until done.
+    void parallelFor(size_t chunkCount, const std::function<void(size_t)>& fn);
+
+private:
+    WorkerPool();
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<size_t> chunks;
+    };
+
+    void workerMain(size_t workerIndex);
+    bool tryRunChunk(size_t preferredQueue);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+
+    std::mutex m_jobMutex;
+    std::mutex m_stateMutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+    //! Read by workers without the state mutex, so the pointer itself is atomic.
+    std::atomic<const std::function<void(size_t)>*> m_activeFn{nullptr};
+    std::atomic<size_t> m_remainingChunks{0};
+    //! Chunks still sitting in the deques, not yet claimed by any lane. Workers
+    //! wake on this rather than m_remainingChunks so they park once the queues
+    //! drain instead of spinning while the last in-flight chunks finish.
+    std::atomic<size_t> m_unclaimedChunks{0};
+    std::atomic<bool> m_shutdown{false};
+};